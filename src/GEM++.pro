@@ -1,9 +1,10 @@
 TEMPLATE = subdirs
-SUBDIRS = dependencies library plugins apps
+SUBDIRS = dependencies library plugins apps tests
 library.depends = dependencies
 apps.depends = library
 apps.depends = dependencies
 plugins.depends = library
+tests.depends = library
 HEADERS += ../doc/pages/GettingStarted.h \
            ../doc/pages/License.h \
            ../doc/pages/MainPage.h \
@@ -76,6 +76,8 @@ int main(int argc, char **argv)
         // Loading all graphs
         GraphList *train = new GraphList(QDir(args.at(0)), ext);
         GraphList *valid = new GraphList(QDir(args.at(1)), ext);
+        train->checkErrors();
+        valid->checkErrors();
 
         // Loading weights
         QString smin = parser.isSet(optSubstitutionMin) ? parser.value(optSubstitutionMin) : "";
@@ -123,6 +123,8 @@ void Hierarchizer::hierarchizeCycles() {
     QString cycleName;
     Graph *subgraph;
     Vertex *cycleVertex;
+    // The vertices and the edges are compacted once, after all the removals
+    output_->beginEdit();
     for(QSet<Vertex *> cycle : cycles_) {
         subgraph = output_->inducedSubgraph(cycle);
 
@@ -142,6 +144,8 @@ void Hierarchizer::hierarchizeCycles() {
         // Remove edges from parent graph
         QList<Edge *> eList = output_->getEdges();
         for(Edge *e : eList) {
+            if(output_->isRemoved(e))
+                continue;
             if(cycle.contains(e->getOrigin()) && cycle.contains(e->getTarget())) {
                 output_->removeEdge(e);
             } else if(cycle.contains(e->getOrigin())) {
@@ -156,6 +160,7 @@ void Hierarchizer::hierarchizeCycles() {
         // FIXME
         //qDeleteAll(cycle);
     }
+    output_->commitEdit();
 }
 
 bool Hierarchizer::isAdmissibleCycle(QSet<Vertex *> cycle) {
@@ -210,6 +215,8 @@ void Hierarchizer::hierarchizeChains() {
     Graph *subgraph;
     QString chainName;
     Vertex *chainVertex;
+    // The vertices and the edges are compacted once, after all the removals
+    output_->beginEdit();
     for(QSet<Edge *> chain : chains_) {
         QSet<Vertex *> vertices;
         for(Edge *edge : chain) {
@@ -222,7 +229,9 @@ void Hierarchizer::hierarchizeChains() {
         // Remove vertices from parent graph
         chainName = "";
         for(Vertex *v : vertices) {
-            output_->removeVertex(v->getID());
+            // A vertex may be shared by several chains
+            if(!output_->isRemoved(v))
+                output_->removeVertex(v->getID());
             chainName += QString("%1_").arg(v->getID());
         }
         chainName.remove(chainName.size()-1, 1);
@@ -235,6 +244,8 @@ void Hierarchizer::hierarchizeChains() {
         // Remove edges from parent graph
         QList<Edge *> eList = output_->getEdges();
         for(Edge *e : eList) {
+            if(output_->isRemoved(e))
+                continue;
             if(chain.contains(e)) {
                 output_->removeEdge(e);
             } else if(vertices.contains(e->getOrigin())) {
@@ -249,6 +260,7 @@ void Hierarchizer::hierarchizeChains() {
         // FIXME
         //qDeleteAll(vertices);
     }
+    output_->commitEdit();
 }
 
 bool Hierarchizer::areChainable(Edge *e1, Edge *e2) {
@@ -10,6 +10,10 @@ MatchingApplication::MatchingApplication(int &argc, char **argv, Problem::Type t
     g2_ = 0;
     gl1_ = 0;
     gl2_ = 0;
+    labels_ = 0;
+    cache_ = 0;
+    memo_ = 0;
+    token_ = new CancellationToken(this);
 }
 
 MatchingApplication::~MatchingApplication() {
@@ -28,12 +32,21 @@ MatchingApplication::~MatchingApplication() {
         delete gl2_;
     if(gl1_)
         delete gl1_;
+    if(labels_)
+        delete labels_;
+    if(cache_)
+        delete cache_;
+    if(memo_)
+        delete memo_;
 }
 
 void MatchingApplication::finished(Problem *problem, double objective) {
     if(!matrix_)
         Exception("The objective matrix must be initialized before updating.");
     matrix_->setElement(problem->getQuery()->getIndex(), problem->getTarget()->getIndex(), objective);
+    // The pairs of graphs identical to the solved ones share its objective
+    for(auto cell : followers_.value(qMakePair(problem->getQuery(), problem->getTarget())))
+        matrix_->setElement(cell.first, cell.second, objective);
 
     mutex_.lock();
     population_.remove(problem);
@@ -71,9 +84,18 @@ int MatchingApplication::match() {
             delete gl1_;
         if(gl2_)
             delete gl2_;
+        if(labels_)
+            delete labels_;
+        if(cache_)
+            delete cache_;
+        if(memo_)
+            delete memo_;
         w_ = 0;
         g1_ = g2_ = 0;
         gl1_ = gl2_ = 0;
+        labels_ = 0;
+        cache_ = 0;
+        memo_ = 0;
 
         // Check number of arguments
         QStringList args = positionalArguments();
@@ -82,25 +104,70 @@ int MatchingApplication::match() {
 
         // Loading weights and graphs
         w_ = new Weights(cfg_->substitution, cfg_->creation);
+        if(cfg_->cacheSize > 0)
+            cache_ = new CostCache(w_, (qint64) cfg_->cacheSize << 20);
+        memo_ = new SubproblemMemo(w_);
         if(isMultiMatching_) {
             gl1_ = new GraphList(QDir(args.at(0)), cfg_->ext);
             gl2_ = (args.at(0).compare(args.at(1)) == 0)? gl1_ : new GraphList(QDir(args.at(1)), cfg_->ext);
+            // The matrices must not silently miss the graphs which could not be loaded
+            gl1_->checkErrors();
+            gl2_->checkErrors();
+
+            // The costs of the labels shared by the dataset are computed once for all the problems
+            if(cfg_->costs.isEmpty()) {
+                labels_ = new LabelTable(w_);
+                for(auto g : *gl1_)
+                    labels_->addGraph(g);
+                for(auto g : *gl2_)
+                    labels_->addGraph(g);
+                labels_->computeCosts();
+            }
         } else {
             g1_ = new Graph(args.at(0));
             g2_ = new Graph(args.at(1));
         }
         initMatrix();
         QThreadPool::globalInstance()->setMaxThreadCount(cfg_->parallelInstances);
+        token_->setDeadline(cfg_->deadline);
 
         // Running the matching(s)
         if(isMultiMatching_) {
-            for(auto i : *gl1_)
-                for(auto j : *gl2_)
-                    if((gl1_ != gl2_) || (j->getIndex() > i->getIndex()))
+            followers_.clear();
+            QHash<QPair<int, int>, QPair<Graph *, Graph *> > solved;
+            QPair<int, int> classes;
+            for(auto i : *gl1_) {
+                for(auto j : *gl2_) {
+                    if((gl1_ == gl2_) && (j->getIndex() <= i->getIndex()))
+                        continue;
+                    if(!cfg_->dedup) {
+                        queue_.enqueue(qMakePair(i,j));
+                        continue;
+                    }
+                    // Identical graphs are at a null distance, and each pair of classes is solved once
+                    if((matchingType_ == Problem::GED) && ((gl1_ == gl2_) ? (gl1_->getClass(i->getIndex()) == gl2_->getClass(j->getIndex())) :
+                                                           (gl1_->getCanonicalHash(i->getIndex()) == gl2_->getCanonicalHash(j->getIndex()) && i->isIsomorphic(j))))
+                        continue;
+                    classes = qMakePair(gl1_->getClass(i->getIndex()), gl2_->getClass(j->getIndex()));
+                    if((gl1_ == gl2_) && (classes.first > classes.second))
+                        qSwap(classes.first, classes.second);
+                    if(solved.contains(classes)) {
+                        followers_[solved.value(classes)].append(qMakePair(i->getIndex(), j->getIndex()));
+                    } else {
+                        solved.insert(classes, qMakePair(i,j));
                         queue_.enqueue(qMakePair(i,j));
+                    }
+                }
+            }
         } else {
             queue_.enqueue(qMakePair(g1_, g2_));
         }
+
+        // All the pairs may be identical graphs, in which case there is nothing to solve
+        if(queue_.isEmpty()) {
+            finalize();
+            return EXIT_SUCCESS;
+        }
         populate();
 
         return exec();
@@ -132,6 +199,12 @@ void MatchingApplication::populate() {
     while(!queue_.isEmpty()) {
         pair = queue_.dequeue();
         Problem *problem = new Problem(matchingType_, pair.first, pair.second);
+        problem->setCancellationToken(token_);
+        problem->setLabelTable(labels_);
+        problem->setCostCache(cache_);
+        problem->setSubproblemMemo(memo_);
+        if(!cfg_->costs.isEmpty())
+            problem->setCostMatrices(new CostMatrices(QString("%1/%2_%3.%4").arg(cfg_->costs, pair.first->getID(), pair.second->getID(), GEMPP_COST_EXT)));
         population_.insert(problem);
         prepare(problem, w_);
     }
@@ -155,6 +228,8 @@ Matrix<double> *MatchingApplication::matrix() {
 void MatchingApplication::addOptions() {
     addSubstitutionOption();
     addCreationOption();
+    addCostsOption();
+    addCacheOption();
     addNumberOption();
     addCutOption();
     if(isMultiMatching_) {
@@ -163,6 +238,7 @@ void MatchingApplication::addOptions() {
         addOutputDirOption();
         addExtensionOption();
         addMatrixOption();
+        addDedupOption();
         addJobsOption();
     } else {
         addProgramOption();
@@ -173,6 +249,7 @@ void MatchingApplication::addOptions() {
     switch(matchingType_) {
         case Problem::GED:
             addFormulationOption();
+            addStartOption();
             break;
         case Problem::SUBGRAPH:
             addToleranceOption();
@@ -181,8 +258,11 @@ void MatchingApplication::addOptions() {
         default:
             break;
     }
+    addSymmetryOption();
+    addBranchingOption();
     addExplorationOption();
     addTimeLimitOption();
+    addDeadlineOption();
     addSolverOption();
     addVerboseOption();
     addVersionOption();
@@ -198,6 +278,10 @@ void MatchingApplication::initConfiguration() {
         cfg_->substitution = optionValue("substitution");
     if(isOptionSet("creation"))
         cfg_->creation = optionValue("creation");
+    if(isOptionSet("costs"))
+        cfg_->costs = optionValue("costs");
+    if(isOptionSet("cache"))
+        cfg_->cacheSize = optionValue("cache").toInt();
     if(isOptionSet("number"))
         cfg_->number = optionValue("number").toInt();
     if(isOptionSet("cut"))
@@ -228,6 +312,7 @@ void MatchingApplication::initConfiguration() {
                 }
             }
         }
+        cfg_->dedup = isOptionSet("dedup");
         if(isOptionSet("jobs"))
             cfg_->parallelInstances = optionValue("jobs").toInt();
         cfg_->threadsPerInstance = qMax(cfg_->threadsPerInstance / cfg_->parallelInstances, 1);
@@ -240,6 +325,7 @@ void MatchingApplication::initConfiguration() {
         case Problem::GED:
             if(isOptionSet("formulation"))
                 cfg_->gedMethod = GraphEditDistance::fromName(optionValue("formulation"));
+            cfg_->bipartiteStart = isOptionSet("start");
             break;
         case Problem::SUBGRAPH:
             if(isOptionSet("tolerance"))
@@ -250,10 +336,14 @@ void MatchingApplication::initConfiguration() {
             break;
     }
 
+    cfg_->symmetry = isOptionSet("symmetry");
+    cfg_->branching = isOptionSet("branching");
     if(isOptionSet("explore"))
         cfg_->upperbound = optionValue("explore").toDouble()/100;
     if(isOptionSet("time"))
         cfg_->timeLimit = optionValue("time").toDouble();
+    if(isOptionSet("deadline"))
+        cfg_->deadline = optionValue("deadline").toDouble();
 
     if(isOptionSet("solver"))
         cfg_->solver = optionValue("solver");
@@ -276,6 +366,14 @@ void MatchingApplication::addCreationOption() {
     addOption("c", "creation", "Defines the weights for creation costs.", "file.fw");
 }
 
+void MatchingApplication::addCostsOption() {
+    addOption("", "costs", "Reads the costs of each pair of graphs from the file 'g1_g2.cost' of the given directory instead of computing them.", "dir");
+}
+
+void MatchingApplication::addCacheOption() {
+    addOption("", "cache", "Stores the costs in a local cache of the given size, in MB, so that the next runs reuse them.", "size");
+}
+
 void MatchingApplication::addNumberOption() {
     addOption("n", "number", "Searches the 'n' best solutions.", "int");
 }
@@ -320,10 +418,18 @@ void MatchingApplication::addMatrixOption() {
     addOption("m", "matrix", "Outputs the distances to the given file.", "file.mat");
 }
 
+void MatchingApplication::addDedupOption() {
+    addOption("", "dedup", "Solves a single pair of graphs for each pair of classes of identical graphs, and copies its objective to the other pairs.");
+}
+
 void MatchingApplication::addFormulationOption() {
     addOption("f", "formulation", "Sets the formulation type (default : l).", "l/q/b", "l");
 }
 
+void MatchingApplication::addStartOption() {
+    addOption("", "start", "Starts the linear formulation from the bipartite approximation.");
+}
+
 void MatchingApplication::addToleranceOption() {
     addOption("t", "tolerance", "Sets the tolerance level (default : t).", "e/l/t", "t");
 }
@@ -332,6 +438,14 @@ void MatchingApplication::addInducedOption() {
     addOption("i", "induced", "Performs induced subgraph matching.");
 }
 
+void MatchingApplication::addSymmetryOption() {
+    addOption("", "symmetry", "Breaks the symmetries of the graphs (automorphisms).");
+}
+
+void MatchingApplication::addBranchingOption() {
+    addOption("", "branching", "Gives the solver branching priorities and hints derived from the graphs.");
+}
+
 void MatchingApplication::addExplorationOption() {
     addOption("e", "explore", "Upper bound approx (cols selection).", "0%-100%");
 }
@@ -340,8 +454,12 @@ void MatchingApplication::addTimeLimitOption() {
     addOption("", "time", "Maximum solving time for on instance.", "number in seconds");
 }
 
+void MatchingApplication::addDeadlineOption() {
+    addOption("", "deadline", "Maximum running time for all instances, best results so far are kept.", "number in seconds");
+}
+
 void MatchingApplication::addSolverOption() {
-    addOption("",  "solver", "Sets the solver (default : Gurobi).", "Cplex/GLPK/Gurobi", "Gurobi");
+    addOption("",  "solver", "Sets the solver (default : Gurobi), Lagrangian needs no plugin but only solves tolerant subgraph matching.", "Cplex/GLPK/Gurobi/Lagrangian", "Gurobi");
 }
 
 void MatchingApplication::addJobsOption() {
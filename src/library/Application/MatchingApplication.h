@@ -4,6 +4,8 @@
 #include <QQueue>
 #include "ConsoleApplication.h"
 #include "Model/GraphList.h"
+#include "Model/LabelTable.h"
+#include "Model/SubproblemMemo.h"
 #include "Solver/Matcher.h"
 
 /**
@@ -101,6 +103,8 @@ class DLL_EXPORT MatchingApplication : public ConsoleApplication {
         // Weights
         void addSubstitutionOption();
         void addCreationOption();
+        void addCostsOption();
+        void addCacheOption();
 
         // Multiple solutions
         void addNumberOption();
@@ -118,15 +122,20 @@ class DLL_EXPORT MatchingApplication : public ConsoleApplication {
         void addAutoSolutionOption();
         void addAutoSolutionsOption();
         void addMatrixOption();
+        void addDedupOption();
 
         // Formulations
         void addFormulationOption();
+        void addStartOption();
         void addToleranceOption();
         void addInducedOption();
+        void addSymmetryOption();
+        void addBranchingOption();
 
         // Approximation
         void addExplorationOption();
         void addTimeLimitOption();
+        void addDeadlineOption();
 
         // Solver
         void addSolverOption();
@@ -183,11 +192,37 @@ class DLL_EXPORT MatchingApplication : public ConsoleApplication {
          */
         GraphList *gl2_;
 
+        /**
+         * @brief The costs of the labels of the sets of graphs.
+         */
+        LabelTable *labels_;
+
+        /**
+         * @brief The cache of the costs on disk.
+         */
+        CostCache *cache_;
+
+        /**
+         * @brief The values of the subproblems of the hierarchical graphs.
+         */
+        SubproblemMemo *memo_;
+
+        /**
+         * @brief The token that stops all the matchings when the deadline is reached.
+         */
+        CancellationToken *token_;
+
         /**
          * @brief The population of active ::Problem.
          */
         QSet<Problem *> population_;
 
+        /**
+         * @brief The cells of the distance matrix which receive the objective of a pair of
+         * identical graphs, when only one pair of each class of identical graphs is solved.
+         */
+        QHash<QPair<Graph *, Graph *>, QList<QPair<int, int> > > followers_;
+
         /**
          * @brief A mutex to lock population update.
          */
@@ -170,7 +170,7 @@ void QConfigurationDialog::toggleMore() {
 void QConfigurationDialog::initTables() {
     Vertex *v = (pb->getQuery()->getVertexCount() > 0)? pb->getQuery()->getVertex(0) : 0;
     Edge *e = (pb->getQuery()->getEdgeCount() > 0)? pb->getQuery()->getEdge(0) : 0;
-    int nbAttr = (v ? v->getAttributes().size() : 0) + (e ? e->getAttributes().size() : 0) + 2; // +2 : constants
+    int nbAttr = (v ? v->getAttributeCount() : 0) + (e ? e->getAttributeCount() : 0) + 2; // +2 : constants
 
     subsTable = new QTableWidget(nbAttr, 3, this);
     subsTable->setHorizontalHeaderLabels(QStringList() << "Element" << "Feature" << "Weight");
@@ -178,7 +178,7 @@ void QConfigurationDialog::initTables() {
     creaTable->setHorizontalHeaderLabels(QStringList() << "Element" << "Feature" << "Weight");
     int row = 0;
     if(v) {
-        QList<QString> attrKeys = v->getAttributes().keys();
+        QList<QString> attrKeys = v->getAttributeNames();
         attrKeys.insert(0, GEMPP_CONST_LABEL);
         for(auto att : attrKeys) {
             QString typeIcon = (att.compare(GEMPP_CONST_LABEL) && v->getAttribute(att)->isTextBased())? ":/images/symbolic.png" : ":/images/numeric.png";
@@ -211,7 +211,7 @@ void QConfigurationDialog::initTables() {
         }
     }
     if(e) {
-        QList<QString> attrKeys = e->getAttributes().keys();
+        QList<QString> attrKeys = e->getAttributeNames();
         attrKeys.insert(0, GEMPP_CONST_LABEL);
         for(auto att : attrKeys) {
             QString typeIcon = (att.compare(GEMPP_CONST_LABEL) && e->getAttribute(att)->isTextBased())? ":/images/symbolic.png" : ":/images/numeric.png";
@@ -255,7 +255,7 @@ void QConfigurationDialog::updateTables() {
 
     int row = 0;
     if(v) {
-        QList<QString> attrKeys = v->getAttributes().keys();
+        QList<QString> attrKeys = v->getAttributeNames();
         attrKeys.insert(0, GEMPP_CONST_LABEL);
         for(auto att : attrKeys) {
             ((QScienceSpinBox *)subsTable->cellWidget(row, 2))->setValue(weights->getWeightOrDefault(Weights::SUBSTITUTION, GraphElement::VERTEX, att)->getValue());
@@ -264,7 +264,7 @@ void QConfigurationDialog::updateTables() {
         }
     }
     if(e) {
-        QList<QString> attrKeys = e->getAttributes().keys();
+        QList<QString> attrKeys = e->getAttributeNames();
         attrKeys.insert(0, GEMPP_CONST_LABEL);
         for(auto att : attrKeys) {
             ((QScienceSpinBox *)subsTable->cellWidget(row, 2))->setValue(weights->getWeightOrDefault(Weights::SUBSTITUTION, GraphElement::EDGE, att)->getValue());
@@ -283,7 +283,7 @@ void QConfigurationDialog::updateWeights() {
     Edge *e = (pb->getQuery()->getEdgeCount() > 0)? pb->getQuery()->getEdge(0) : 0;
     int row = 0;
     if(v) {
-        QList<QString> attrKeys = v->getAttributes().keys();
+        QList<QString> attrKeys = v->getAttributeNames();
         attrKeys.insert(0, GEMPP_CONST_LABEL);
         for(auto att : attrKeys) {
             weights->getWeightOrDefault(Weights::SUBSTITUTION, GraphElement::VERTEX, att)->setValue(((QScienceSpinBox *)subsTable->cellWidget(row, 2))->value());
@@ -292,7 +292,7 @@ void QConfigurationDialog::updateWeights() {
         }
     }
     if(e) {
-        QList<QString> attrKeys = e->getAttributes().keys();
+        QList<QString> attrKeys = e->getAttributeNames();
         attrKeys.insert(0, GEMPP_CONST_LABEL);
         for(auto att : attrKeys) {
             weights->getWeightOrDefault(Weights::SUBSTITUTION, GraphElement::EDGE, att)->setValue(((QScienceSpinBox *)subsTable->cellWidget(row, 2))->value());
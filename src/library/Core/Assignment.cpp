@@ -0,0 +1,88 @@
+#include "Assignment.h"
+
+QVector<int> Assignment::solve(const QVector<double> &costs, int rows, int cols, bool partial) {
+    QVector<int> assignment(rows, -1);
+    if(rows == 0 || cols == 0)
+        return assignment;
+
+    // The algorithm assigns every row of a matrix that has less rows than columns
+    bool transposed = (rows > cols);
+    int n = transposed ? cols : rows;
+    int m = transposed ? rows : cols;
+    auto a = [&](int i, int j) {
+        double c = transposed ? costs[j*cols + i] : costs[i*cols + j];
+        return partial ? qMin(c, 0.0) : c;
+    };
+
+    // Potentials u (rows) and v (columns), p[j] is the row assigned to column j,
+    // way[j] is the previous column in the augmenting path (indexes start at 1)
+    QVector<double> u(n+1, 0), v(m+1, 0), minv(m+1);
+    QVector<int> p(m+1, 0), way(m+1, 0);
+    QVector<bool> used(m+1);
+    int i0, j0, j1;
+    double delta, cur;
+    for(int i=1; i <= n; ++i) {
+        p[0] = i;
+        j0 = 0;
+        minv.fill(INFINITY);
+        used.fill(false);
+        do {
+            used[j0] = true;
+            i0 = p[j0];
+            delta = INFINITY;
+            j1 = 0;
+            for(int j=1; j <= m; ++j) {
+                if(!used[j]) {
+                    cur = a(i0-1, j-1) - u[i0] - v[j];
+                    if(cur < minv[j]) {
+                        minv[j] = cur;
+                        way[j] = j0;
+                    }
+                    if(minv[j] < delta) {
+                        delta = minv[j];
+                        j1 = j;
+                    }
+                }
+            }
+            for(int j=0; j <= m; ++j) {
+                if(used[j]) {
+                    u[p[j]] += delta;
+                    v[j] -= delta;
+                } else {
+                    minv[j] -= delta;
+                }
+            }
+            j0 = j1;
+        } while(p[j0] != 0);
+        // Augments the matching along the path
+        do {
+            j1 = way[j0];
+            p[j0] = p[j1];
+            j0 = j1;
+        } while(j0);
+    }
+
+    for(int j=1; j <= m; ++j) {
+        if(p[j]) {
+            if(transposed)
+                assignment[j-1] = p[j]-1;
+            else
+                assignment[p[j]-1] = j-1;
+        }
+    }
+
+    // A non-negative cost is equivalent to no assignment
+    if(partial)
+        for(int i=0; i < rows; ++i)
+            if(assignment[i] >= 0 && costs[i*cols + assignment[i]] >= 0)
+                assignment[i] = -1;
+    return assignment;
+}
+
+double Assignment::cost(const QVector<double> &costs, int cols, const QVector<int> &assignment) {
+    double c = 0;
+    for(int i=0; i < assignment.size(); ++i)
+        if(assignment[i] >= 0)
+            c += costs[i*cols + assignment[i]];
+    return c;
+}
@@ -0,0 +1,41 @@
+#ifndef GEMPP_ASSIGNMENT_H
+#define GEMPP_ASSIGNMENT_H
+
+#include <QVector>
+#include "Constants.h"
+
+/**
+ * @brief The Assignment class is a utility that solves the linear sum assignment
+ * problem (LSAP) with the shortest augmenting path version of the Hungarian algorithm,
+ * in \f$ O(n^2 m) \f$ time where \f$ n \leq m \f$ are the dimensions of the cost matrix.
+ * It is used wherever an assignment has to be computed without a solver plugin.
+ *
+ * @author J.Lerouge <julien.lerouge@litislab.fr>
+ */
+class DLL_EXPORT Assignment {
+    public:
+        /**
+         * @brief Solves a rectangular assignment problem : each row (resp. column) is assigned
+         * to a distinct column (resp. row) if there are less rows than columns (resp. columns
+         * than rows), so that the sum of the assigned costs is minimal.
+         * When partial is true, a row may also stay unassigned, and it does so whenever
+         * its assignment would have a non-negative cost.
+         * @param costs the finite costs, in row-major order
+         * @param rows the number of rows
+         * @param cols the number of columns
+         * @param partial allows partial assignments
+         * @return the column assigned to each row, or -1 if the row is not assigned
+         */
+        static QVector<int> solve(const QVector<double> &costs, int rows, int cols, bool partial = false);
+
+        /**
+         * @brief Returns the cost of an assignment.
+         * @param costs the costs, in row-major order
+         * @param cols the number of columns
+         * @param assignment the column assigned to each row, or -1 if the row is not assigned
+         * @return the sum of the assigned costs
+         */
+        static double cost(const QVector<double> &costs, int cols, const QVector<int> &assignment);
+};
+
+#endif /* GEMPP_ASSIGNMENT_H */
@@ -0,0 +1,44 @@
+#include <climits>
+#include "CancellationToken.h"
+
+CancellationToken::CancellationToken(QObject *parent) : QObject(parent), cancelled_(0), deadline_(-1) {
+    timer_.setSingleShot(true);
+    connect(&timer_, SIGNAL(timeout()), this, SLOT(cancel()));
+}
+
+CancellationToken::~CancellationToken() {}
+
+void CancellationToken::setDeadline(double seconds) {
+    timer_.stop();
+    if(std::isinf(seconds) || std::isnan(seconds)) {
+        deadline_.store(-1);
+    } else {
+        qint64 delay = (qint64)qMax(seconds * 1000, 0.0);
+        deadline_.store(QDateTime::currentMSecsSinceEpoch() + delay);
+        // The deadlines beyond the range of the timer are only polled
+        if(delay <= INT_MAX)
+            timer_.start((int)delay);
+    }
+}
+
+bool CancellationToken::hasDeadline() const {
+    return (deadline_.load() >= 0);
+}
+
+double CancellationToken::getRemainingTime() const {
+    if(cancelled_.load())
+        return 0;
+    qint64 deadline = deadline_.load();
+    if(deadline < 0)
+        return INFINITY;
+    return qMax(deadline - QDateTime::currentMSecsSinceEpoch(), (qint64)0) / 1000.0;
+}
+
+bool CancellationToken::isCancelled() const {
+    return (getRemainingTime() <= 0);
+}
+
+void CancellationToken::cancel() {
+    if(cancelled_.testAndSetOrdered(0, 1))
+        emit cancelled();
+}
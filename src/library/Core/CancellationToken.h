@@ -0,0 +1,93 @@
+#ifndef GEMPP_CANCELLATIONTOKEN_H
+#define GEMPP_CANCELLATIONTOKEN_H
+
+#include <QObject>
+#include <QAtomicInt>
+#include <QAtomicInteger>
+#include <QDateTime>
+#include <QTimer>
+
+#include "Constants.h"
+
+/**
+ * @brief The CancellationToken class is shared by all the tasks of a same job
+ * (cost computation, formulation building, solving) to stop them cooperatively.
+ * A token is stopped either when it is explicitly cancelled, or when its
+ * wall-clock deadline is reached, in which case it is cancelled by a timer of the
+ * thread that owns the token. Long running loops poll ::isCancelled, while
+ * solvers use ::getRemainingTime as a time limit and are interrupted through
+ * the ::cancelled signal.
+ *
+ * @author J.Lerouge <julien.lerouge@litislab.fr>
+ */
+class DLL_EXPORT CancellationToken : public QObject {
+        Q_OBJECT
+    public:
+        /**
+         * @brief Constructs a new CancellationToken object, without deadline.
+         * @param parent the parent object
+         */
+        CancellationToken(QObject *parent = 0);
+
+        /**
+         * @brief Destructs a CancellationToken object.
+         */
+        virtual ~CancellationToken();
+
+        /**
+         * @brief Sets a wall-clock deadline, relatively to the current time.
+         * The token is cancelled when the deadline is reached, provided that its thread runs an event loop.
+         * It must be called from the thread that owns the token.
+         * @param seconds the number of seconds before the deadline, INFINITY to remove the deadline
+         */
+        void setDeadline(double seconds);
+
+        /**
+         * @brief Indicates whether the token has a deadline.
+         * @return a boolean
+         */
+        bool hasDeadline() const;
+
+        /**
+         * @brief Returns the time left before the deadline.
+         * @return the remaining time in seconds, 0 if the token is cancelled, INFINITY if there is no deadline
+         */
+        double getRemainingTime() const;
+
+        /**
+         * @brief Indicates whether the token has been cancelled or its deadline has been reached.
+         * @return a boolean
+         */
+        bool isCancelled() const;
+
+    public slots:
+        /**
+         * @brief Cancels the token, every task sharing it should stop as soon as possible.
+         */
+        void cancel();
+
+    signals:
+        /**
+         * @brief Notifies that the token has been cancelled, explicitly or at its deadline.
+         * It is emitted from the thread that called ::cancel.
+         */
+        void cancelled();
+
+    private:
+        /**
+         * @brief Indicates whether the token has been explicitly cancelled.
+         */
+        QAtomicInt cancelled_;
+
+        /**
+         * @brief The deadline in milliseconds since epoch, or a negative value when there is no deadline.
+         */
+        QAtomicInteger<qint64> deadline_;
+
+        /**
+         * @brief The single-shot timer which cancels the token at its deadline.
+         */
+        QTimer timer_;
+};
+
+#endif /* GEMPP_CANCELLATIONTOKEN_H */
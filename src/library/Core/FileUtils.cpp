@@ -41,6 +41,20 @@ void FileUtils::close(QFile &file) {
     file.close();
 }
 
+const char *FileUtils::map(QFile &file, QByteArray &buffer, qint64 &size) {
+    const char *data = 0;
+    size = file.size();
+    if(size > 0)
+        data = (const char *) file.map(0, size);
+    if(!data) {
+        buffer = file.readAll();
+        data = buffer.constData();
+        size = buffer.size();
+    }
+    file.close();
+    return data;
+}
+
 QString FileUtils::getExtension(const QString &filename) {
     return QFileInfo(filename).suffix();
 }
@@ -65,6 +65,17 @@ class DLL_EXPORT FileUtils {
          */
         static void close(QFile &file);
 
+        /**
+         * @brief Maps the content of an open file in memory, or reads it when the file cannot be mapped,
+         * e.g. a pipe. The file is closed in both cases, so that no descriptor is held: the mapping
+         * remains valid as long as the QFile object exists.
+         * @param file the file, opened for reading
+         * @param buffer receives the content of the file when it cannot be mapped
+         * @param size receives the size of the content
+         * @return the content of the file, either mapped or the data of the buffer
+         */
+        static const char *map(QFile &file, QByteArray &buffer, qint64 &size);
+
         /**
          * @brief Returns the extension of a filename.
          * @param filename the path to the file
@@ -11,3 +11,11 @@ double roundAtPrecision(double number) {
 long roundToNearestInt(double number) {
     return (long)(number + 0.5);
 }
+
+double ipow(double x, unsigned p) {
+    if(p == 0)
+        return 1;
+    if(p == 1)
+        return x;
+    return (p % 2) ? ipow(x*x, p/2)*x : ipow(x*x, p/2);
+}
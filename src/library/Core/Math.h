@@ -24,4 +24,22 @@ DLL_EXPORT double roundAtPrecision(double number);
  */
 DLL_EXPORT long roundToNearestInt(double number);
 
+/**
+ * @brief Raises a double variable to a power known at compile time, by repeated squaring.
+ * It gives the same result as ipow(double, unsigned), and allows the compiler to vectorize the loops using it.
+ * @param x the number
+ * @return x to the power P
+ */
+template<unsigned P> inline double ipow(double x) { return (P % 2) ? ipow<P/2>(x*x)*x : ipow<P/2>(x*x); }
+template<> inline double ipow<1>(double x) { return x; }
+template<> inline double ipow<0>(double) { return 1; }
+
+/**
+ * @brief Raises a double variable to an integer power, by repeated squaring.
+ * @param x the number
+ * @param p the power
+ * @return x to the power p
+ */
+DLL_EXPORT double ipow(double x, unsigned p);
+
 #endif /* GEMPP_MATH_H */
@@ -0,0 +1,46 @@
+#include "StringPool.h"
+
+QReadWriteLock StringPool::lock_;
+QHash<QString, int> StringPool::ids_;
+QAtomicPointer<QString> StringPool::chunks_[GEMPP_STRINGPOOL_CHUNKS];
+QAtomicInt StringPool::size_(0);
+
+int StringPool::intern(const QString &string) {
+    int id = find(string);
+    if(id >= 0)
+        return id;
+
+    QWriteLocker locker(&lock_);
+    // Another thread may have interned the string in the meantime
+    auto it = ids_.constFind(string);
+    if(it != ids_.constEnd())
+        return it.value();
+    id = size_.load();
+    if(id >= GEMPP_STRINGPOOL_CHUNK * GEMPP_STRINGPOOL_CHUNKS)
+        Exception(QString("The string pool is full (%1 strings)").arg(id));
+    QString *chunk = chunks_[id / GEMPP_STRINGPOOL_CHUNK].load();
+    if(!chunk) {
+        chunk = new QString[GEMPP_STRINGPOOL_CHUNK];
+        chunks_[id / GEMPP_STRINGPOOL_CHUNK].storeRelease(chunk);
+    }
+    chunk[id % GEMPP_STRINGPOOL_CHUNK] = string;
+    ids_.insert(string, id);
+    size_.storeRelease(id + 1);
+    return id;
+}
+
+int StringPool::find(const QString &string) {
+    QReadLocker locker(&lock_);
+    return ids_.value(string, -1);
+}
+
+QString StringPool::get(int id) {
+    // Acquiring the size makes the strings stored before it visible
+    if(id < 0 || id >= size_.loadAcquire())
+        Exception(QString("The string %1 has never been interned").arg(id));
+    return chunks_[id / GEMPP_STRINGPOOL_CHUNK].loadAcquire()[id % GEMPP_STRINGPOOL_CHUNK];
+}
+
+int StringPool::size() {
+    return size_.loadAcquire();
+}
@@ -0,0 +1,74 @@
+#ifndef GEMPP_STRINGPOOL_H
+#define GEMPP_STRINGPOOL_H
+
+#include <QAtomicInt>
+#include <QAtomicPointer>
+#include <QHash>
+#include <QReadWriteLock>
+
+#include "Constants.h"
+
+/**
+ * @brief The number of strings in a chunk of the ::StringPool.
+ */
+#define GEMPP_STRINGPOOL_CHUNK 4096
+
+/**
+ * @brief The maximum number of chunks of the ::StringPool.
+ */
+#define GEMPP_STRINGPOOL_CHUNKS 16384
+
+/**
+ * @brief The StringPool class interns strings process-wide: each distinct string is stored
+ * once and designated by a stable integer identifier. Equal strings always get the same
+ * identifier, so they can be compared and hashed as integers, and the interned copies share
+ * a single buffer thanks to Qt implicit sharing.
+ *
+ * It is used for the names and the textual values of the attributes.
+ * All the methods are thread-safe. The strings are stored in chunks which are never moved,
+ * so that StringPool::get does not lock the pool.
+ *
+ * @author J.Lerouge <julien.lerouge@litislab.fr>
+ */
+class DLL_EXPORT StringPool {
+    public:
+        /**
+         * @brief Returns the identifier of a string, adding it to the pool if needed.
+         * @param string the string
+         * @return the identifier
+         */
+        static int intern(const QString &string);
+
+        /**
+         * @brief Returns the identifier of a string, without adding it to the pool.
+         * @param string the string
+         * @return the identifier, or -1 if the string has never been interned
+         */
+        static int find(const QString &string);
+
+        /**
+         * @brief Returns an interned string, without locking the pool.
+         * @param id the identifier
+         * @return the string, sharing its buffer with the pool
+         */
+        static QString get(int id);
+
+        /**
+         * @brief Returns the number of interned strings.
+         * @return the size of the pool
+         */
+        static int size();
+
+    private:
+        static QReadWriteLock lock_;
+        static QHash<QString, int> ids_;
+
+        /**
+         * @brief The chunks of strings, allocated when needed, and the number of strings they hold.
+         * A string is published by increasing the size once it has been stored.
+         */
+        static QAtomicPointer<QString> chunks_[GEMPP_STRINGPOOL_CHUNKS];
+        static QAtomicInt size_;
+};
+
+#endif /* GEMPP_STRINGPOOL_H */
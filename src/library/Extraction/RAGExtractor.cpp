@@ -90,6 +90,11 @@ void RegionAdjacencyGraphExtractor::performExtraction() {
         qcout << "Making graph topology..." << endl;
     Edge *e;
     Vertex *origin, *target;
+    // The columns of the metadata are looked up once, the values are read from them in the loop
+    Metadata *metadata = graph_->getMetadata();
+    int cx = metadata->getColumn(GraphElement::VERTEX, "centroid_x");
+    int cy = metadata->getColumn(GraphElement::VERTEX, "centroid_y");
+    int ca = metadata->getColumn(GraphElement::VERTEX, "area");
     for(int i=0; i < graph_->getVertexCount(); ++i) {
         for(int j=i+1; j < graph_->getVertexCount(); ++j) {
             if(areAdjacent(CCs[i], BBs[i], CCs[j], BBs[j])) {
@@ -104,12 +109,12 @@ void RegionAdjacencyGraphExtractor::performExtraction() {
                 target->addEdge(e, Vertex::EDGE_IN);
 
                 double x1, x2, y1, y2, area1, area2;
-                x1 = graph_->getMetadata()->getAttribute(GraphElement::VERTEX, origin->getIndex(), "centroid_x").toDouble();
-                x2 = graph_->getMetadata()->getAttribute(GraphElement::VERTEX, target->getIndex(), "centroid_x").toDouble();
-                y1 = graph_->getMetadata()->getAttribute(GraphElement::VERTEX, origin->getIndex(), "centroid_y").toDouble();
-                y2 = graph_->getMetadata()->getAttribute(GraphElement::VERTEX, target->getIndex(), "centroid_y").toDouble();
-                area1 = graph_->getMetadata()->getAttribute(GraphElement::VERTEX, origin->getIndex(), "area").toDouble();
-                area2 = graph_->getMetadata()->getAttribute(GraphElement::VERTEX, target->getIndex(), "area").toDouble();
+                x1 = metadata->getNumber(GraphElement::VERTEX, cx, origin->getIndex());
+                x2 = metadata->getNumber(GraphElement::VERTEX, cx, target->getIndex());
+                y1 = metadata->getNumber(GraphElement::VERTEX, cy, origin->getIndex());
+                y2 = metadata->getNumber(GraphElement::VERTEX, cy, target->getIndex());
+                area1 = metadata->getNumber(GraphElement::VERTEX, ca, origin->getIndex());
+                area2 = metadata->getNumber(GraphElement::VERTEX, ca, target->getIndex());
 
                 // Relative position and area
                 e->addAttribute("dist", QMetaType::Double, sqrt(((x2 - x1)*(x2 - x1) + (y2 - y1)*(y2 - y1))/(area1 + area2)));
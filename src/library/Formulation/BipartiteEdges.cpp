@@ -2,8 +2,8 @@
 
 BipartiteEdges::BipartiteEdges(Problem *pb, int i, int k) : Formulation(pb) {
     lp_ = new LinearProgram(Program::MINIMIZE);
-    vi_ = pb->getQuery()->getVertex(i);
-    vk_ = pb->getTarget()->getVertex(k);
+    vi_ = i;
+    vk_ = k;
     init();
 }
 
@@ -15,15 +15,15 @@ BipartiteEdges::~BipartiteEdges() {
 }
 
 void BipartiteEdges::initVariables() {
-    int nEi, nEk;
-    nEi = vi_->getEdges(Vertex::EDGE_IN_OUT).size();
-    nEk = vk_->getEdges(Vertex::EDGE_IN_OUT).size();
+    CompactGraph::Range ei = query_->getEdges(vi_, Vertex::EDGE_IN_OUT);
+    CompactGraph::Range ek = target_->getEdges(vk_, Vertex::EDGE_IN_OUT);
+    int nEi = ei.size(), nEk = ek.size();
 
     QString id;
     y_variables = Matrix<Variable*>(nEi, nEk);
     for(ij=0; ij < nEi; ++ij) {
         for(kl=0; kl < nEk; ++kl) {
-            id = QString("y_%1,%2").arg(vi_->getEdge(ij, Vertex::EDGE_IN_OUT)->getIndex()).arg(vk_->getEdge(kl, Vertex::EDGE_IN_OUT)->getIndex());
+            id = QString("y_%1,%2").arg(ei[ij]).arg(ek[kl]);
             y_variables.setElement(ij, kl, new Variable(id));
         }
     }
@@ -36,9 +36,9 @@ void BipartiteEdges::restrictProblem(double up) {
 }
 
 void BipartiteEdges::initConstraints() {
-    int nEi, nEk;
-    nEi = vi_->getEdges(Vertex::EDGE_IN_OUT).size();
-    nEk = vk_->getEdges(Vertex::EDGE_IN_OUT).size();
+    CompactGraph::Range ei = query_->getEdges(vi_, Vertex::EDGE_IN_OUT);
+    CompactGraph::Range ek = target_->getEdges(vk_, Vertex::EDGE_IN_OUT);
+    int nEi = ei.size(), nEk = ek.size();
 
     for(ij=0; ij < nEi; ++ij)
         *lp_ += new LinearConstraint(LinearExpression::sum(y_variables.getRow(ij)), LinearConstraint::LESS_EQ, 1.0);
@@ -48,22 +48,22 @@ void BipartiteEdges::initConstraints() {
 }
 
 void BipartiteEdges::initObjective() {
-    int nEi, nEk;
-    nEi = vi_->getEdges(Vertex::EDGE_IN_OUT).size();
-    nEk = vk_->getEdges(Vertex::EDGE_IN_OUT).size();
+    CompactGraph::Range ei = query_->getEdges(vi_, Vertex::EDGE_IN_OUT);
+    CompactGraph::Range ek = target_->getEdges(vk_, Vertex::EDGE_IN_OUT);
+    int nEi = ei.size(), nEk = ek.size();
     LinearExpression *exp = new LinearExpression();
 
     for(ij=0; ij < nEi; ++ij)
         for(kl=0; kl < nEk; ++kl)
-            *exp += *y_variables.getElement(ij,kl)*(pb_->getCost(GraphElement::EDGE, vi_->getEdge(ij, Vertex::EDGE_IN_OUT)->getIndex(), vk_->getEdge(kl, Vertex::EDGE_IN_OUT)->getIndex())
-                                                    - vi_->getEdge(ij, Vertex::EDGE_IN_OUT)->getCost() - vk_->getEdge(kl, Vertex::EDGE_IN_OUT)->getCost());
+            *exp += *y_variables.getElement(ij,kl)*(pb_->getCost(GraphElement::EDGE, ei[ij], ek[kl])
+                                                    - pb_->getQuery()->getEdge(ei[ij])->getCost() - pb_->getTarget()->getEdge(ek[kl])->getCost());
 
     // Constant part of the objective
     double c = 0;
     for(ij=0; ij < nEi; ++ij)
-        c += vi_->getEdge(ij, Vertex::EDGE_IN_OUT)->getCost();
+        c += pb_->getQuery()->getEdge(ei[ij])->getCost();
     for(kl=0; kl < nEk; ++kl)
-        c += vk_->getEdge(kl, Vertex::EDGE_IN_OUT)->getCost();
+        c += pb_->getTarget()->getEdge(ek[kl])->getCost();
 
     *exp += c;
     lp_->setObjective(exp);
@@ -31,7 +31,7 @@ class DLL_EXPORT BipartiteEdges: public Formulation {
         virtual void cut(Solution *sol, CutMethod cm);
 
     private:
-        Vertex *vi_, *vk_;
+        int vi_, vk_;
 
         /**
          * @brief The matrix of the edge substitution variables.
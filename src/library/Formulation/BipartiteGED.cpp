@@ -9,6 +9,26 @@ BipartiteGraphMatching::~BipartiteGraphMatching() {
     delete lp_;
 }
 
+void BipartiteGraphMatching::initCosts() {
+    queryCosts_ = QVector<double>(nVP);
+    for(i=0; i < nVP; ++i) {
+        queryCosts_[i] = pb_->getQuery()->getVertex(i)->getCost();
+        for(int e : query_->getEdges(i, Vertex::EDGE_IN_OUT))
+            queryCosts_[i] += pb_->getQuery()->getEdge(e)->getCost();
+    }
+    targetCosts_ = QVector<double>(nVT);
+    for(k=0; k < nVT; ++k) {
+        targetCosts_[k] = pb_->getTarget()->getVertex(k)->getCost();
+        for(int e : target_->getEdges(k, Vertex::EDGE_IN_OUT))
+            targetCosts_[k] += pb_->getTarget()->getEdge(e)->getCost();
+    }
+
+    x_costs = Matrix<double>(nVP, nVT);
+    for(i=0; i < nVP; ++i)
+        for(k=0; k < nVT; ++k)
+            x_costs.setElement(i, k, pb_->getCost(GraphElement::VERTEX, i, k) - queryCosts_[i] - targetCosts_[k]);
+}
+
 void BipartiteGraphMatching::initConstraints() {
     for(i=0; i < nVP; ++i)
         *lp_ += new LinearConstraint(LinearExpression::sum(x_variables.getRow(i)), LinearConstraint::LESS_EQ, 1.0);
@@ -27,9 +47,9 @@ void BipartiteGraphMatching::initObjective() {
     // Constant part of the objective
     double c = 0;
     for(i=0; i < nVP; ++i)
-        c += pb_->getQuery()->getVertex(i)->getCost();
+        c += queryCosts_[i];
     for(k=0; k < nVT; ++k)
-        c += pb_->getTarget()->getVertex(k)->getCost();
+        c += targetCosts_[k];
 
     *exp += c;
     lp_->setObjective(exp);
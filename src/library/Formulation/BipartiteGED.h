@@ -25,6 +25,15 @@ class DLL_EXPORT BipartiteGraphMatching: virtual public GraphEditDistance {
         virtual ~BipartiteGraphMatching();
 
     protected:
+        /**
+         * @brief The creation costs of the vertices of both graphs, including the costs of their incident edges,
+         * as the substitutions of these edges are part of the vertex substitution costs.
+         * They are kept in the formulation since the graphs are shared by several problems.
+         */
+        QVector<double> queryCosts_;
+        QVector<double> targetCosts_;
+
+        virtual void initCosts();
         virtual void initConstraints();
         virtual void initObjective();
 };
@@ -1,4 +1,6 @@
 #include "Formulation.h"
+#include "Core/Assignment.h"
+#include "Model/Symmetry.h"
 
 const char *Formulation::cutMethodName[Formulation::COUNT] = {
     "Solution",
@@ -18,7 +20,7 @@ QString Formulation::toName(CutMethod method) {
     return cutMethodName[(int)method];
 }
 
-Formulation::Formulation() : pb_(0), p_(0), lp_(0), qp_(0), induced_(false) {}
+Formulation::Formulation() : pb_(0), query_(0), target_(0), p_(0), lp_(0), qp_(0), induced_(false) {}
 
 Formulation::Formulation(Problem *pb, bool induced) : Formulation() {
     pb_ = pb;
@@ -56,11 +58,19 @@ void Formulation::init(double up) {
     nET = pb_->getTarget()->getEdgeCount();
     i = j = k = l = ij = kl = 0;
     isDirected = (pb_->getQuery()->getType() == Graph::DIRECTED);
+    query_ = pb_->getCompactQuery();
+    target_ = pb_->getCompactTarget();
     initVariables();
-    initCosts();
-    restrictProblem(up);
-    initConstraints();
-    initObjective();
+    // The building steps are skipped as soon as the problem is cancelled,
+    // the resulting program is not meant to be solved
+    if(!pb_->isCancelled())
+        initCosts();
+    if(!pb_->isCancelled())
+        restrictProblem(up);
+    if(!pb_->isCancelled())
+        initConstraints();
+    if(!pb_->isCancelled())
+        initObjective();
     if(lp_ != 0)
         p_ = (Program *) lp_;
     else if(qp_ != 0)
@@ -68,3 +78,81 @@ void Formulation::init(double up) {
     else
         Exception("The program has not been created during formulation initialization");
 }
+
+void Formulation::addSymmetryConstraints(Matrix<Variable *> &x_variables) {
+    QList<Orbit> queryChain = Symmetry(pb_->getQuery()).getStabilizerChain();
+    QList<Orbit> targetChain = Symmetry(pb_->getTarget()).getStabilizerChain();
+    bool onQuery = (Symmetry::getGroupOrder(queryChain) >= Symmetry::getGroupOrder(targetChain));
+    QList<Orbit> &chain = onQuery ? queryChain : targetChain;
+    int nOther = onQuery ? pb_->getTarget()->getVertexCount() : pb_->getQuery()->getVertexCount();
+
+    // Returns x_o,p for an orbit of the query graph, and x_p,o for an orbit of the target graph
+    auto x = [&x_variables, onQuery](int o, int p) {
+        return onQuery ? x_variables.getElement(o, p) : x_variables.getElement(p, o);
+    };
+
+    // sum_{o in O\r} x_o,p <= sum_{q < p} x_r,q
+    LinearExpression *e;
+    for(auto orbit : chain) {
+        for(int p=0; p < nOther; ++p) {
+            e = new LinearExpression();
+            for(int o : orbit.second)
+                if(o != orbit.first)
+                    e->addTerm(*x(o, p));
+            for(int q=0; q < p; ++q)
+                e->addTerm(*x(orbit.first, q)*(-1));
+            *lp_ += new LinearConstraint(e, LinearConstraint::LESS_EQ, 0.0);
+        }
+    }
+}
+
+void Formulation::addBranchingHints(Matrix<Variable *> &x_variables, const Matrix<double> &x_costs, bool partial, Matrix<Variable *> *y_variables) {
+    Variable *v;
+
+    // Vertex substitutions first, the most connected query vertices first
+    int priority;
+    for(i=0; i < nVP; ++i) {
+        priority = 1 + query_->getDegree(i);
+        for(k=0; k < nVT; ++k)
+            x_variables.getElement(i, k)->setBranchPriority(priority);
+    }
+
+    // The deactivated substitutions are too expensive to be assigned
+    double big = 1;
+    for(i=0; i < nVP; ++i)
+        for(k=0; k < nVT; ++k)
+            big += fabs(x_costs.getElement(i, k));
+    QVector<double> costs(nVP*nVT);
+    for(i=0; i < nVP; ++i)
+        for(k=0; k < nVT; ++k)
+            costs[i*nVT + k] = x_variables.getElement(i, k)->isActive() ? x_costs.getElement(i, k) : big;
+    QVector<int> assignment = Assignment::solve(costs, nVP, nVT, partial);
+    for(i=0; i < nVP; ++i) {
+        if(assignment[i] >= 0 && !x_variables.getElement(i, assignment[i])->isActive())
+            assignment[i] = -1;
+        for(k=0; k < nVT; ++k)
+            x_variables.getElement(i, k)->setHint(assignment[i] == k ? 1 : 0);
+    }
+    if(!y_variables)
+        return;
+
+    // Each query edge is hinted to the first active target edge between the images of its extremities
+    int o, t;
+    bool found;
+    for(ij=0; ij < nEP; ++ij) {
+        o = assignment[query_->getOrigin(ij)];
+        t = assignment[query_->getTarget(ij)];
+        found = false;
+        for(kl=0; kl < nET; ++kl) {
+            v = y_variables->getElement(ij, kl);
+            if(!found && o >= 0 && t >= 0 && v->isActive() &&
+               ((target_->getOrigin(kl) == o && target_->getTarget(kl) == t) ||
+                (!isDirected && target_->getOrigin(kl) == t && target_->getTarget(kl) == o))) {
+                v->setHint(1);
+                found = true;
+            } else {
+                v->setHint(0);
+            }
+        }
+    }
+}
@@ -67,6 +67,7 @@ class DLL_EXPORT Formulation {
 
         /**
          * @brief Initializes the formulation, calling the abstract methods of the subclass.
+         * The initialization stops early if the problem is cancelled (see Problem::isCancelled).
          * @param up the upper bound approximation parameter
          */
         void init(double up = 1.0);
@@ -78,6 +79,22 @@ class DLL_EXPORT Formulation {
          */
         virtual void cut(Solution *sol, CutMethod cm) = 0;
 
+        /**
+         * @brief Adds constraints that prevent the solver from exploring solutions that
+         * are equivalent through an automorphism of the query or the target graph.
+         * At least one optimal solution remains feasible.
+         * @see Symmetry
+         */
+        virtual void breakSymmetries() {}
+
+        /**
+         * @brief Gives branching priorities and hint values to the variables, so that
+         * the solver does not see them as an unstructured binary program.
+         * The feasible set of the program is unchanged.
+         * @see Variable::setBranchPriority, Variable::setHint
+         */
+        virtual void setBranchingHints() {}
+
         /**
          * @brief Sets the problem to solve.
          * @param pb the problem
@@ -114,6 +131,11 @@ class DLL_EXPORT Formulation {
          */
         Problem *pb_;
 
+        /**
+         * @brief The compact structures of the query and target graphs of the problem.
+         */
+        const CompactGraph *query_, *target_;
+
         /**
          * @brief The program (linear or quadratic) made to solve the problem.
          */
@@ -140,6 +162,29 @@ class DLL_EXPORT Formulation {
         int i, j, k, l, ij, kl;
         bool isDirected;
 
+        /**
+         * @brief Adds symmetry-breaking constraints on the vertex substitution variables.
+         * The stabilizer chains of both graphs are computed, and only the one describing
+         * the most automorphisms is used, the constraints of both chains being incompatible
+         * in general. For each orbit of the chain, a vertex of the orbit can be matched to
+         * a vertex of the other graph only if its representative is matched to a vertex
+         * of lower index.
+         * @param x_variables the matrix of the vertex substitution variables
+         */
+        void addSymmetryConstraints(Matrix<Variable *> &x_variables);
+
+        /**
+         * @brief Sets the branching priorities and the hint values of the substitution variables.
+         * The vertex substitutions are branched on before the edge substitutions, those of the most
+         * connected query vertices first. The hints of the vertex substitutions are an optimal
+         * assignment w.r.t. their costs only, and the hints of the edge substitutions follow it.
+         * @param x_variables the matrix of the vertex substitution variables
+         * @param x_costs the matrix of the vertex substitution costs
+         * @param partial allows query vertices to stay unassigned, when their cost is not negative
+         * @param y_variables the matrix of the edge substitution variables, if any
+         */
+        void addBranchingHints(Matrix<Variable *> &x_variables, const Matrix<double> &x_costs, bool partial, Matrix<Variable *> *y_variables = 0);
+
         /**
          * @brief Initializes the substitution variables.
          */
@@ -87,3 +87,11 @@ void GraphEditDistance::cut(Solution *sol, CutMethod cm) {
     else if(qp_)
         *qp_ += c;
 }
+
+void GraphEditDistance::breakSymmetries() {
+    addSymmetryConstraints(x_variables);
+}
+
+void GraphEditDistance::setBranchingHints() {
+    addBranchingHints(x_variables, x_costs, true);
+}
@@ -52,6 +52,8 @@ class DLL_EXPORT GraphEditDistance : virtual public Formulation {
         virtual ~GraphEditDistance();
 
         virtual void cut(Solution *sol, CutMethod cm);
+        virtual void breakSymmetries();
+        virtual void setBranchingHints();
 
     protected:
         /**
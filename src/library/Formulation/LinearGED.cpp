@@ -1,4 +1,5 @@
 #include "LinearGED.h"
+#include "Core/Assignment.h"
 
 LinearGraphEditDistance::LinearGraphEditDistance(Problem *pb, double up) : Formulation(pb) {
     lp_ = new LinearProgram(Program::MINIMIZE);
@@ -12,6 +13,75 @@ LinearGraphEditDistance::~LinearGraphEditDistance() {
             delete it;
 }
 
+void LinearGraphEditDistance::setBranchingHints() {
+    addBranchingHints(x_variables, x_costs, true, &y_variables);
+}
+
+void LinearGraphEditDistance::setBipartiteStart() {
+    // Vertex substitution costs, including the half cost of the best assignment of the incident edges
+    QVector<double> costs(nVP*nVT), edgeCosts;
+    double big = 1;
+    int a, b;
+    for(i=0; i < nVP; ++i) {
+        CompactGraph::Range qEdges = query_->getEdges(i, Vertex::EDGE_IN_OUT);
+        for(k=0; k < nVT; ++k) {
+            CompactGraph::Range tEdges = target_->getEdges(k, Vertex::EDGE_IN_OUT);
+            edgeCosts = QVector<double>(qEdges.size()*tEdges.size());
+            for(a=0; a < qEdges.size(); ++a)
+                for(b=0; b < tEdges.size(); ++b)
+                    // A deactivated substitution is never profitable
+                    edgeCosts[a*tEdges.size() + b] = y_variables.getElement(qEdges[a], tEdges[b])->isActive() ? getEdgeCost(qEdges[a], tEdges[b]) : 0;
+            costs[i*nVT + k] = x_costs.getElement(i, k) + Assignment::cost(edgeCosts, tEdges.size(), Assignment::solve(edgeCosts, qEdges.size(), tEdges.size(), true))/2;
+            big += fabs(costs[i*nVT + k]);
+        }
+    }
+    for(i=0; i < nVP; ++i)
+        for(k=0; k < nVT; ++k)
+            if(!x_variables.getElement(i, k)->isActive())
+                costs[i*nVT + k] = big;
+    QVector<int> assignment = Assignment::solve(costs, nVP, nVT, true);
+
+    QHash<Variable *, int> start;
+    double objective = lp_->getObjective()->getConst();
+    for(i=0; i < nVP; ++i) {
+        if(assignment[i] >= 0 && !x_variables.getElement(i, assignment[i])->isActive())
+            assignment[i] = -1;
+        for(k=0; k < nVT; ++k)
+            start.insert(x_variables.getElement(i, k), (assignment[i] == k) ? 1 : 0);
+        if(assignment[i] >= 0)
+            objective += x_costs.getElement(i, assignment[i]);
+    }
+
+    // Each query edge is substituted to the cheapest free target edge between the images of its extremities
+    QVector<bool> used(nET, false);
+    int o, t, best;
+    for(ij=0; ij < nEP; ++ij) {
+        o = assignment[query_->getOrigin(ij)];
+        t = assignment[query_->getTarget(ij)];
+        best = -1;
+        if(o >= 0 && t >= 0) {
+            // The target edges between both images are among the out-edges of the image of the origin
+            for(int e : target_->getEdges(o, isDirected ? Vertex::EDGE_OUT : Vertex::EDGE_IN_OUT)) {
+                kl = e;
+                if(target_->getNeighbour(o, kl) != t)
+                    continue;
+                if(used[kl] || !y_variables.getElement(ij, kl)->isActive() || getEdgeCost(ij, kl) >= 0)
+                    continue;
+                if(best < 0 || getEdgeCost(ij, kl) < getEdgeCost(ij, best))
+                    best = kl;
+            }
+        }
+        if(best >= 0) {
+            used[best] = true;
+            objective += getEdgeCost(ij, best);
+        }
+        for(kl=0; kl < nET; ++kl)
+            start.insert(y_variables.getElement(ij, kl), (kl == best) ? 1 : 0);
+    }
+
+    lp_->setStart(start, objective);
+}
+
 void LinearGraphEditDistance::initVariables() {
     GraphEditDistance::initVariables();
     QString id;
@@ -24,12 +94,8 @@ void LinearGraphEditDistance::initVariables() {
     }
 }
 
-void LinearGraphEditDistance::initCosts() {
-    GraphEditDistance::initCosts();
-    y_costs = Matrix<double>(nEP, nET);
-    for(ij=0; ij < nEP; ++ij)
-        for(kl=0; kl < nET; ++kl)
-            y_costs.setElement(ij, kl, pb_->getCost(GraphElement::EDGE, ij, kl) - pb_->getQuery()->getEdge(ij)->getCost() - pb_->getTarget()->getEdge(kl)->getCost());
+double LinearGraphEditDistance::getEdgeCost(int ij, int kl) {
+    return pb_->getCost(GraphElement::EDGE, ij, kl) - pb_->getQuery()->getEdge(ij)->getCost() - pb_->getTarget()->getEdge(kl)->getCost();
 }
 
 void LinearGraphEditDistance::restrictProblem(double up) {
@@ -40,11 +106,11 @@ void LinearGraphEditDistance::restrictProblem(double up) {
                 v->activate();
 
         for(ij=0; ij < nEP; ++ij) {
-            i = pb_->getQuery()->getEdge(ij)->getOrigin()->getIndex();
-            j = pb_->getQuery()->getEdge(ij)->getTarget()->getIndex();
+            i = query_->getOrigin(ij);
+            j = query_->getTarget(ij);
             for(kl=0; kl < nET; ++kl) {
-                k = pb_->getTarget()->getEdge(kl)->getOrigin()->getIndex();
-                l = pb_->getTarget()->getEdge(kl)->getTarget()->getIndex();
+                k = target_->getOrigin(kl);
+                l = target_->getTarget(kl);
                 if(isDirected) {
                     // y_ij,kl must be 0 if the couple (x_i,k * x_j,l) is inactive
                     if(!(x_variables.getElement(i, k)->isActive() && x_variables.getElement(j, l)->isActive()))
@@ -100,17 +166,15 @@ void LinearGraphEditDistance::initConstraints() {
     // (F2)
     LinearExpression *e1, *e2;
     for(ij=0; ij < nEP; ++ij) {
-        i = pb_->getQuery()->getEdge(ij)->getOrigin()->getIndex();
-        j = pb_->getQuery()->getEdge(ij)->getTarget()->getIndex();
+        i = query_->getOrigin(ij);
+        j = query_->getTarget(ij);
         for(k=0; k < nVT; ++k) {
             e1 = new LinearExpression();
             e2 = new LinearExpression();
-            QSet<Edge *> edges = pb_->getTarget()->getVertex(k)->getEdges(Vertex::EDGE_OUT);
-            for(auto it = edges.begin(); it != edges.end(); ++it)
-                e1->addTerm(*(y_variables.getElement(ij,(*it)->getIndex())));
-            edges = pb_->getTarget()->getVertex(k)->getEdges(Vertex::EDGE_IN);
-            for(auto it = edges.begin(); it != edges.end(); ++it)
-                e2->addTerm(*(y_variables.getElement(ij,(*it)->getIndex())));
+            for(int e : target_->getEdges(k, Vertex::EDGE_OUT))
+                e1->addTerm(*(y_variables.getElement(ij, e)));
+            for(int e : target_->getEdges(k, Vertex::EDGE_IN))
+                e2->addTerm(*(y_variables.getElement(ij, e)));
             e1->addTerm(*(x_variables.getElement(i, k))*(-1));
             e2->addTerm(*(x_variables.getElement(j, k))*(-1));
             if(!isDirected) {
@@ -130,9 +194,11 @@ void LinearGraphEditDistance::initObjective() {
         for(k=0; k < nVT; ++k)
             *exp += *x_variables.getElement(i, k)*x_costs.getElement(i, k);
 
+    // The deactivated variables are null, their costs are not evaluated
     for(ij=0; ij < nEP; ++ij)
         for(kl=0; kl < nET; ++kl)
-            *exp += *y_variables.getElement(ij, kl)*y_costs.getElement(ij, kl);
+            if(y_variables.getElement(ij, kl)->isActive())
+                *exp += *y_variables.getElement(ij, kl)*getEdgeCost(ij, kl);
 
     // Constant part of the objective
     double c = 0;
@@ -24,6 +24,19 @@ class DLL_EXPORT LinearGraphEditDistance : public GraphEditDistance {
          */
         virtual ~LinearGraphEditDistance();
 
+        virtual void setBranchingHints();
+
+        /**
+         * @brief Gives the program a starting solution computed with the bipartite approximation,
+         * as in BipartiteGraphMatching. The substitution cost of two vertices is increased by the
+         * half cost of the best assignment of their incident edges, the vertices are assigned w.r.t.
+         * these costs, and each query edge is substituted to the cheapest free target edge between
+         * the images of its extremities. The local edge assignments are solved with ::Assignment,
+         * so the costs of the problem are left unchanged.
+         * @see Program::setStart
+         */
+        void setBipartiteStart();
+
     private:
         /**
          * @brief The matrix of the edge substitution variables.
@@ -31,12 +44,16 @@ class DLL_EXPORT LinearGraphEditDistance : public GraphEditDistance {
         Matrix<Variable*> y_variables;
 
         /**
-         * @brief The matrix of the edge substitution costs.
+         * @brief Returns the cost of an edge substitution variable.
+         * The edge costs are evaluated by the ::Problem on their first request,
+         * so that only the costs of the active variables are asked for.
+         * @param ij the index of the edge of the query graph
+         * @param kl the index of the edge of the target graph
+         * @return the cost
          */
-        Matrix<double> y_costs;
+        double getEdgeCost(int ij, int kl);
 
         virtual void initVariables();
-        virtual void initCosts();
         virtual void restrictProblem(double up);
         virtual void initConstraints();
         virtual void initObjective();
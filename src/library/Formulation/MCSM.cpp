@@ -5,14 +5,20 @@ MinimumCostSubgraphMatching::MinimumCostSubgraphMatching(Problem *pb, double up,
     init(up);
 }
 
+void MinimumCostSubgraphMatching::setBranchingHints() {
+    // A query vertex whose substitution is not profitable is hinted to be removed
+    addBranchingHints(x_variables, x_costs, true, &y_variables);
+}
+
 void MinimumCostSubgraphMatching::initCosts() {
     SubgraphMatching::initCosts();
     for(i=0; i < nVP; ++i)
         for(k=0; k < nVT; ++k)
             x_costs.addElement(i, k, -pb_->getQuery()->getVertex(i)->getCost());
-    for(ij=0; ij < nEP; ++ij)
-        for(kl=0; kl < nET; ++kl)
-            y_costs.addElement(ij, kl, -pb_->getQuery()->getEdge(ij)->getCost());
+}
+
+double MinimumCostSubgraphMatching::getEdgeCost(int ij, int kl) {
+    return SubgraphMatching::getEdgeCost(ij, kl) - pb_->getQuery()->getEdge(ij)->getCost();
 }
 
 void MinimumCostSubgraphMatching::initConstraints() {
@@ -27,17 +33,15 @@ void MinimumCostSubgraphMatching::initConstraints() {
 
     LinearExpression *e1, *e2;
     for(ij=0; ij < nEP; ++ij) {
-        i = pb_->getQuery()->getEdge(ij)->getOrigin()->getIndex();
-        j = pb_->getQuery()->getEdge(ij)->getTarget()->getIndex();
+        i = query_->getOrigin(ij);
+        j = query_->getTarget(ij);
         for(k=0; k < nVT; ++k) {
             e1 = new LinearExpression();
             e2 = new LinearExpression();
-            QSet<Edge *> edges = pb_->getTarget()->getVertex(k)->getEdges(Vertex::EDGE_OUT);
-            for(auto it = edges.begin(); it != edges.end(); ++it)
-                e1->addTerm(*(y_variables.getElement(ij,(*it)->getIndex())));
-            edges = pb_->getTarget()->getVertex(k)->getEdges(Vertex::EDGE_IN);
-            for(auto it = edges.begin(); it != edges.end(); ++it)
-                e2->addTerm(*(y_variables.getElement(ij,(*it)->getIndex())));
+            for(int e : target_->getEdges(k, Vertex::EDGE_OUT))
+                e1->addTerm(*(y_variables.getElement(ij, e)));
+            for(int e : target_->getEdges(k, Vertex::EDGE_IN))
+                e2->addTerm(*(y_variables.getElement(ij, e)));
             e1->addTerm(*(x_variables.getElement(i, k))*(-1));
             e2->addTerm(*(x_variables.getElement(j, k))*(-1));
             if(!isDirected) {
@@ -52,8 +56,8 @@ void MinimumCostSubgraphMatching::initConstraints() {
     LinearExpression *e;
     if(induced_) {
         for(kl=0; kl < nET; ++kl) {
-            k = pb_->getTarget()->getEdge(kl)->getOrigin()->getIndex();
-            l = pb_->getTarget()->getEdge(kl)->getTarget()->getIndex();
+            k = target_->getOrigin(kl);
+            l = target_->getTarget(kl);
             e = new LinearExpression();
             for(auto v : x_variables.getCol(k))
                 e->addTerm(*v);
@@ -25,7 +25,10 @@ class DLL_EXPORT MinimumCostSubgraphMatching : virtual public SubstitutionTolera
          */
         virtual ~MinimumCostSubgraphMatching() {}
 
+        virtual void setBranchingHints();
+
     protected:
+        virtual double getEdgeCost(int ij, int kl);
         virtual void initCosts();
         virtual void initConstraints();
         virtual void initObjective();
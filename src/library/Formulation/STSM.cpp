@@ -37,11 +37,11 @@ void SubstitutionTolerantSubgraphMatching::restrictProblem(double up) {
         }
 
         for(ij=0; ij < nEP; ++ij) {
-            i = pb_->getQuery()->getEdge(ij)->getOrigin()->getIndex();
-            j = pb_->getQuery()->getEdge(ij)->getTarget()->getIndex();
+            i = query_->getOrigin(ij);
+            j = query_->getTarget(ij);
             for(kl=0; kl < nET; ++kl) {
-                k = pb_->getTarget()->getEdge(kl)->getOrigin()->getIndex();
-                l = pb_->getTarget()->getEdge(kl)->getTarget()->getIndex();
+                k = target_->getOrigin(kl);
+                l = target_->getTarget(kl);
                 if(isDirected) {
                     // y_ij,kl must be 0 if the couple (x_i,k * x_j,l) is inactive
                     if(!(x_variables.getElement(i, k)->isActive() && x_variables.getElement(j, l)->isActive()))
@@ -93,22 +93,20 @@ void SubstitutionTolerantSubgraphMatching::initConstraints() {
     // (F2)
     LinearExpression *e1, *e2;
     for(ij=0; ij < nEP; ++ij) {
-        i = pb_->getQuery()->getEdge(ij)->getOrigin()->getIndex();
-        j = pb_->getQuery()->getEdge(ij)->getTarget()->getIndex();
+        i = query_->getOrigin(ij);
+        j = query_->getTarget(ij);
         for(k=0; k < nVT; ++k) {
             e1 = new LinearExpression();
             e2 = new LinearExpression();
-            QSet<Edge *> edges = pb_->getTarget()->getVertex(k)->getEdges(Vertex::EDGE_OUT);
-            for(auto it = edges.begin(); it != edges.end(); ++it) {
-                e1->addTerm(*(y_variables.getElement(ij,(*it)->getIndex())));
+            for(int e : target_->getEdges(k, Vertex::EDGE_OUT)) {
+                e1->addTerm(*(y_variables.getElement(ij, e)));
                 //if(!isDirected)
-                    //e2->addTerm(*(y_variables.getElement(ij,(*it)->getIndex())));
+                    //e2->addTerm(*(y_variables.getElement(ij, e)));
             }
-            edges = pb_->getTarget()->getVertex(k)->getEdges(Vertex::EDGE_IN);
-            for(auto it = edges.begin(); it != edges.end(); ++it) {
-                e2->addTerm(*(y_variables.getElement(ij,(*it)->getIndex())));
+            for(int e : target_->getEdges(k, Vertex::EDGE_IN)) {
+                e2->addTerm(*(y_variables.getElement(ij, e)));
                 //if(!isDirected)
-                    //e1->addTerm(*(y_variables.getElement(ij,(*it)->getIndex())));
+                    //e1->addTerm(*(y_variables.getElement(ij, e)));
             }
             e1->addTerm(*(x_variables.getElement(i, k))*(-1));
             e2->addTerm(*(x_variables.getElement(j, k))*(-1));
@@ -127,8 +125,8 @@ void SubstitutionTolerantSubgraphMatching::initConstraints() {
     LinearExpression *e;
     if(induced_) {
         for(kl=0; kl < nET; ++kl) {
-            k = pb_->getTarget()->getEdge(kl)->getOrigin()->getIndex();
-            l = pb_->getTarget()->getEdge(kl)->getTarget()->getIndex();
+            k = target_->getOrigin(kl);
+            l = target_->getTarget(kl);
             e = new LinearExpression();
             for(auto v : x_variables.getCol(k))
                 e->addTerm(*v);
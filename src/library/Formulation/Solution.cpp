@@ -83,14 +83,24 @@ double Solution::getObjective() {
     return objective_;
 }
 
+void Solution::setBound(double bound) {
+    bound_ = std::isfinite(bound) ? roundAtPrecision(bound) : bound;
+}
+
+double Solution::getBound() {
+    return bound_;
+}
+
 void Solution::clean() {
     variables_.clear();
     switch(formulation_->getProgram()->getSense()) {
         case Program::MINIMIZE:
             objective_ = INFINITY;
+            bound_ = -INFINITY;
             break;
         case Program::MAXIMIZE:
             objective_ = -INFINITY;
+            bound_ = INFINITY;
             break;
     }
     status_ = NOT_SOLVED;
@@ -111,7 +121,10 @@ void Solution::print(Printer *p) {
 }
 
 void Solution::printSolution(Printer *p) {
-    p->dump(QString("<objective status=\"%1\" value=\"%2\"/>").arg(toName(status_)).arg(objective_));
+    if(std::isfinite(bound_))
+        p->dump(QString("<objective status=\"%1\" value=\"%2\" bound=\"%3\"/>").arg(toName(status_)).arg(objective_).arg(bound_));
+    else
+        p->dump(QString("<objective status=\"%1\" value=\"%2\"/>").arg(toName(status_)).arg(objective_));
     Problem *pb = formulation_->getProblem();
 
     if(status_ == SUBOPTIMAL || status_ == OPTIMAL) {
@@ -109,6 +109,18 @@ class DLL_EXPORT Solution : virtual public IPrintable, virtual public ISaveable,
          */
         double getObjective();
 
+        /**
+         * @brief Sets the proven bound on the objective value, e.g. a lower bound when minimizing.
+         * @param bound the bound
+         */
+        void setBound(double bound);
+
+        /**
+         * @brief Returns the proven bound on the objective value.
+         * @return the bound, infinite if none is known
+         */
+        double getBound();
+
         /**
          * @brief Tests whether this solution is really a solution of the problem
          * (i.e. it is suboptimal or optimal) or an invalid solution.
@@ -167,6 +179,11 @@ class DLL_EXPORT Solution : virtual public IPrintable, virtual public ISaveable,
          * @brief The objective value of the solution.
          */
         double objective_;
+
+        /**
+         * @brief The proven bound on the objective value.
+         */
+        double bound_;
 };
 
 #endif /* GEMPP_SOLUTION_H */
@@ -23,25 +23,24 @@ void SubgraphIsomorphism::restrictProblem(double up) {
                 x_variables.getElement(i, k)->deactivate();
 
     for(ij=0; ij < nEP; ++ij) {
-        i = pb_->getQuery()->getEdge(ij)->getOrigin()->getIndex();
-        j = pb_->getQuery()->getEdge(ij)->getTarget()->getIndex();
+        i = query_->getOrigin(ij);
+        j = query_->getTarget(ij);
         for(kl=0; kl < nET; ++kl) {
-            if(y_costs.getElement(ij, kl) > precision)
-                y_variables.getElement(ij, kl)->deactivate();
-            else {
-                k = pb_->getTarget()->getEdge(kl)->getOrigin()->getIndex();
-                l = pb_->getTarget()->getEdge(kl)->getTarget()->getIndex();
-                if(isDirected) {
-                    // y_ij,kl must be 0 if the couple (x_i,k * x_j,l) is inactive
-                    if(!(x_variables.getElement(i, k)->isActive() && x_variables.getElement(j, l)->isActive()))
-                        y_variables.getElement(ij, kl)->deactivate();
-                } else {
-                    // y_ij,kl must be 0 if the couples (x_i,k * x_j,l) and (x_i,l * x_j,k) are inactive
-                    if(!((x_variables.getElement(i, k)->isActive() && x_variables.getElement(j, l)->isActive()) ||
-                         (x_variables.getElement(i, l)->isActive() && x_variables.getElement(j, k)->isActive())))
-                        y_variables.getElement(ij, kl)->deactivate();
-                }
+            k = target_->getOrigin(kl);
+            l = target_->getTarget(kl);
+            if(isDirected) {
+                // y_ij,kl must be 0 if the couple (x_i,k * x_j,l) is inactive
+                if(!(x_variables.getElement(i, k)->isActive() && x_variables.getElement(j, l)->isActive()))
+                    y_variables.getElement(ij, kl)->deactivate();
+            } else {
+                // y_ij,kl must be 0 if the couples (x_i,k * x_j,l) and (x_i,l * x_j,k) are inactive
+                if(!((x_variables.getElement(i, k)->isActive() && x_variables.getElement(j, l)->isActive()) ||
+                     (x_variables.getElement(i, l)->isActive() && x_variables.getElement(j, k)->isActive())))
+                    y_variables.getElement(ij, kl)->deactivate();
             }
+            // The cost is only evaluated for the pairs which remain
+            if(y_variables.getElement(ij, kl)->isActive() && getEdgeCost(ij, kl) > precision)
+                y_variables.getElement(ij, kl)->deactivate();
         }
     }
 }
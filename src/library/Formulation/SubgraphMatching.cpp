@@ -52,10 +52,10 @@ void SubgraphMatching::initCosts() {
     for(i=0; i < nVP; ++i)
         for(k=0; k < nVT; ++k)
             x_costs.setElement(i, k, pb_->getCost(GraphElement::VERTEX, i, k));
-    y_costs = Matrix<double>(nEP, nET);
-    for(ij=0; ij < nEP; ++ij)
-        for(kl=0; kl < nET; ++kl)
-            y_costs.setElement(ij, kl, pb_->getCost(GraphElement::EDGE, ij, kl));
+}
+
+double SubgraphMatching::getEdgeCost(int ij, int kl) {
+    return pb_->getCost(GraphElement::EDGE, ij, kl);
 }
 
 void SubgraphMatching::initObjective() {
@@ -64,9 +64,11 @@ void SubgraphMatching::initObjective() {
         for(k=0; k < nVT; ++k)
             *exp += *x_variables.getElement(i, k)*x_costs.getElement(i, k);
 
+    // The deactivated variables are null, their costs are not evaluated
     for(ij=0; ij < nEP; ++ij)
         for(kl=0; kl < nET; ++kl)
-            *exp += *y_variables.getElement(ij, kl)*y_costs.getElement(ij, kl);
+            if(y_variables.getElement(ij, kl)->isActive())
+                *exp += *y_variables.getElement(ij, kl)*getEdgeCost(ij, kl);
 
     lp_->setObjective(exp);
 }
@@ -100,3 +102,11 @@ void SubgraphMatching::cut(Solution *sol, CutMethod cm) {
     }
     *lp_ += c;
 }
+
+void SubgraphMatching::breakSymmetries() {
+    addSymmetryConstraints(x_variables);
+}
+
+void SubgraphMatching::setBranchingHints() {
+    addBranchingHints(x_variables, x_costs, false, &y_variables);
+}
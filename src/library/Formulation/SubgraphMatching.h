@@ -58,6 +58,8 @@ class DLL_EXPORT SubgraphMatching : virtual public Formulation{
         virtual ~SubgraphMatching();
 
         virtual void cut(Solution *sol, CutMethod cm);
+        virtual void breakSymmetries();
+        virtual void setBranchingHints();
 
     protected:
         /**
@@ -76,9 +78,14 @@ class DLL_EXPORT SubgraphMatching : virtual public Formulation{
         Matrix<double> x_costs;
 
         /**
-         * @brief The matrix of the edge substitution costs.
+         * @brief Returns the cost of an edge substitution variable.
+         * The edge costs are evaluated by the ::Problem on their first request,
+         * so that only the costs of the active variables are asked for.
+         * @param ij the index of the edge of the query graph
+         * @param kl the index of the edge of the target graph
+         * @return the cost
          */
-        Matrix<double> y_costs;
+        virtual double getEdgeCost(int ij, int kl);
 
         virtual void initVariables();
         virtual void initCosts();
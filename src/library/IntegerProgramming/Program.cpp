@@ -2,6 +2,7 @@
 
 Program::Program(Sense sense) {
     sense_ = sense;
+    startObjective_ = (sense == MINIMIZE) ? INFINITY : -INFINITY;
 }
 
 Program::~Program() {}
@@ -27,3 +28,25 @@ Program::Sense Program::getSense() {
 void Program::setSense(Sense sense) {
     sense_ = sense;
 }
+
+void Program::setStart(const QHash<Variable *, int> &start, double objective) {
+    start_ = start;
+    startObjective_ = objective;
+}
+
+bool Program::hasStart() {
+    return !start_.isEmpty();
+}
+
+const QHash<Variable *, int> &Program::getStart() {
+    return start_;
+}
+
+double Program::getStartObjective() {
+    return startObjective_;
+}
+
+void Program::clearStart() {
+    start_.clear();
+    startObjective_ = (sense_ == MINIMIZE) ? INFINITY : -INFINITY;
+}
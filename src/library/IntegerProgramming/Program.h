@@ -89,6 +89,37 @@ class DLL_EXPORT Program : virtual public IPrintable, virtual public ISaveable {
          */
         void setSense(Sense sense);
 
+        /**
+         * @brief Sets a feasible solution from which the solver starts. Its objective value is also used as a cutoff,
+         * so that the solver does not explore solutions that are worse than it.
+         * @param start the values of the variables of the solution
+         * @param objective the objective value of the solution
+         */
+        void setStart(const QHash<Variable *, int> &start, double objective);
+
+        /**
+         * @brief Tests if a starting solution has been given to the Program.
+         * @return whether the Program has a starting solution
+         */
+        bool hasStart();
+
+        /**
+         * @brief Returns the values of the variables of the starting solution.
+         * @return the value of Program::start_
+         */
+        const QHash<Variable *, int> &getStart();
+
+        /**
+         * @brief Returns the objective value of the starting solution.
+         * @return the value of Program::startObjective_
+         */
+        double getStartObjective();
+
+        /**
+         * @brief Removes the starting solution, e.g. once the program has been cut.
+         */
+        void clearStart();
+
     protected:
         /**
          * @brief Add a Variable to the variables used by the Program.
@@ -105,6 +136,16 @@ class DLL_EXPORT Program : virtual public IPrintable, virtual public ISaveable {
          * @brief The variables that appear in the objective function and the constraints of the Program.
          */
         QHash<QString, Variable *> variables_;
+
+        /**
+         * @brief The values of the variables of the starting solution, empty if there is none.
+         */
+        QHash<Variable *, int> start_;
+
+        /**
+         * @brief The objective value of the starting solution.
+         */
+        double startObjective_;
 };
 
 #endif /*PROGRAM_H*/
@@ -1,6 +1,6 @@
 #include "Variable.h"
 
-Variable::Variable(QString id, Type type, int lowerBound, int upperBound) : Identified(id), type_(type) {
+Variable::Variable(QString id, Type type, int lowerBound, int upperBound) : Identified(id), type_(type), priority_(0), hint_(0), hasHint_(false) {
     activate(lowerBound, upperBound);
     columns_ = QHash<QString, double>();
     value_ = lowerBound_;
@@ -30,6 +30,27 @@ bool Variable::isActive() {
     return (lowerBound_ != 0 || upperBound_ != 0);
 }
 
+int Variable::getBranchPriority() {
+    return priority_;
+}
+
+void Variable::setBranchPriority(int priority) {
+    priority_ = priority;
+}
+
+bool Variable::hasHint() {
+    return hasHint_;
+}
+
+int Variable::getHint() {
+    return hint_;
+}
+
+void Variable::setHint(int hint) {
+    hint_ = hint;
+    hasHint_ = true;
+}
+
 int Variable::getLowerBound() {
     return lowerBound_;
 }
@@ -114,6 +114,38 @@ class DLL_EXPORT Variable : virtual public IPrintable, public Identified {
          */
         bool isActive();
 
+        /**
+         * @brief Returns the branching priority of the Variable.
+         * @return the value of Variable::priority_
+         */
+        int getBranchPriority();
+
+        /**
+         * @brief Sets the branching priority of the Variable. The solver branches first on the variables
+         * of highest priority, the default priority being 0.
+         * @param priority the priority to set
+         */
+        void setBranchPriority(int priority);
+
+        /**
+         * @brief Tests if a hint value has been given to the Variable.
+         * @return whether the Variable has a hint value
+         */
+        bool hasHint();
+
+        /**
+         * @brief Returns the hint value of the Variable.
+         * @return the value of Variable::hint_
+         */
+        int getHint();
+
+        /**
+         * @brief Sets the hint value of the Variable, i.e. the value it is likely to take in an optimal solution.
+         * Unlike a bound, the solver is free to ignore it.
+         * @param hint the hint value to set
+         */
+        void setHint(int hint);
+
         /**
          * @brief Tests if a Variable is active, i.e. its bounds are not both 0.
          * @return whether the Variable is active
@@ -133,6 +165,9 @@ class DLL_EXPORT Variable : virtual public IPrintable, public Identified {
         int lowerBound_;
         int value_;
         Type type_;
+        int priority_;
+        int hint_;
+        bool hasHint_;
 };
 
 /**
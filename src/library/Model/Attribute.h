@@ -40,7 +40,7 @@ class DLL_EXPORT Attribute {
         /**
          * @brief Constructs a new Attribute object.
          */
-        Attribute(QMetaType::Type type, QVariant value);
+        Attribute(QMetaType::Type type = QMetaType::UnknownType, QVariant value = QVariant());
 
         /**
          * @brief Constructs a copy of an existing Attribute object.
@@ -0,0 +1,107 @@
+#include "AttributeTable.h"
+#include "Core/StringPool.h"
+
+AttributeSchema::AttributeSchema() {}
+
+AttributeSchema::~AttributeSchema() {}
+
+int AttributeSchema::addColumn(int name, QMetaType::Type type) {
+    int column = getColumn(name);
+    if(column >= 0)
+        return column;
+
+    column = names_.size();
+    names_.append(name);
+    types_.append(type);
+    columns_.insert(name, column);
+
+    // Keeps the columns sorted by name
+    QString string = StringPool::get(name);
+    int rank;
+    for(rank = 0; rank < sorted_.size() && StringPool::get(names_[sorted_[rank]]) < string; ++rank);
+    sorted_.insert(rank, column);
+    return column;
+}
+
+int AttributeSchema::getColumn(int name) const {
+    return columns_.value(name, -1);
+}
+
+int AttributeSchema::getColumnCount() const {
+    return names_.size();
+}
+
+int AttributeSchema::getName(int column) const {
+    return names_[column];
+}
+
+QMetaType::Type AttributeSchema::getType(int column) const {
+    return types_[column];
+}
+
+const QVector<int> &AttributeSchema::getColumns() const {
+    return sorted_;
+}
+
+AttributeTable::~AttributeTable() {}
+
+AttributeSchema *AttributeTable::getSchema() const {
+    return schema_;
+}
+
+int AttributeTable::getRowCount() const {
+    return rowCount_;
+}
+
+const double *AttributeTable::getNumericColumn(int column) const {
+    return numeric_[column].constData();
+}
+
+const int *AttributeTable::getTextColumn(int column) const {
+    return text_[column].constData();
+}
+
+bool AttributeTable::isComplete(int column) const {
+    if(column >= valueCount_.size())
+        return (rowCount_ == 0);
+    return (valueCount_[column] == rowCount_);
+}
+
+bool AttributeTable::isTextual(int column) const {
+    if(column >= textCount_.size())
+        return (rowCount_ == 0);
+    return (textCount_[column] == valueCount_[column]);
+}
+
+bool AttributeTable::isNumerical(int column) const {
+    if(column >= textCount_.size())
+        return true;
+    return (textCount_[column] == 0);
+}
+
+QString AttributeTable::getString(int column, int row) const {
+    if(text_[column][row] >= 0)
+        return StringPool::get(text_[column][row]);
+    return QString::number(numeric_[column][row]);
+}
+
+void AttributeTable::setRow(int row, const GraphElement *element) {
+    const Attribute *att;
+    int column;
+    for(int rank = 0; rank < element->getAttributeCount(); ++rank) {
+        att = element->getAttribute(rank);
+        column = schema_->addColumn(element->getAttributeID(rank), att->getType());
+        while(numeric_.size() <= column) {
+            numeric_.append(QVector<double>(rowCount_, NAN));
+            text_.append(QVector<int>(rowCount_, -1));
+            valueCount_.append(0);
+            textCount_.append(0);
+        }
+        numeric_[column][row] = att->getValue().toDouble();
+        ++valueCount_[column];
+        if(att->isTextBased()) {
+            text_[column][row] = StringPool::intern(att->getValue().toString());
+            ++textCount_[column];
+        }
+    }
+}
@@ -0,0 +1,218 @@
+#ifndef GEMPP_ATTRIBUTETABLE_H
+#define GEMPP_ATTRIBUTETABLE_H
+
+#include <QHash>
+#include <QVector>
+#include <qnumeric.h>
+#include "GraphElement.h"
+
+/**
+ * @brief The AttributeSchema class describes the columns of one or several ::AttributeTable,
+ * i.e. the attribute names found in their elements, interned in the ::StringPool.
+ * The tables of the query and the target of a ::Problem share the same schema, so that a
+ * column designates the same attribute in both of them.
+ * @see AttributeTable
+ * @see CostProgram
+ */
+class DLL_EXPORT AttributeSchema {
+    public:
+        /**
+         * @brief Constructs a new empty AttributeSchema object.
+         */
+        AttributeSchema();
+
+        /**
+         * @brief Destructs an AttributeSchema object.
+         */
+        ~AttributeSchema();
+
+        /**
+         * @brief Returns the column of an attribute, adding it to the schema if needed.
+         * @param name the identifier of the attribute name in the ::StringPool
+         * @param type the type of the attribute, which is kept only for a new column
+         * @return the column
+         */
+        int addColumn(int name, QMetaType::Type type);
+
+        /**
+         * @brief Returns the column of an attribute.
+         * @param name the identifier of the attribute name in the ::StringPool
+         * @return the column, or -1 if the schema has no such attribute
+         */
+        int getColumn(int name) const;
+
+        /**
+         * @brief Returns the number of columns.
+         * @return the column count
+         */
+        int getColumnCount() const;
+
+        /**
+         * @brief Returns the name of a column.
+         * @param column the column
+         * @return the identifier of the attribute name in the ::StringPool
+         */
+        int getName(int column) const;
+
+        /**
+         * @brief Returns the type of the first value found in a column.
+         * @param column the column
+         * @return the type
+         */
+        QMetaType::Type getType(int column) const;
+
+        /**
+         * @brief Returns the columns sorted by attribute name, which is the order of GraphElement::getAttributeNames.
+         * @return the columns
+         */
+        const QVector<int> &getColumns() const;
+
+    private:
+        QVector<int> names_;
+        QVector<QMetaType::Type> types_;
+        QHash<int, int> columns_;
+        QVector<int> sorted_;
+};
+
+/**
+ * @brief The AttributeTable class stores the attributes of the vertices or the edges of a ::Graph
+ * in columns, one row per element, following the indexes of the elements.
+ *
+ * Each value is stored as a double, and the textual values are additionally stored as their
+ * identifier in the ::StringPool, so that evaluating a cost between two elements only involves
+ * array indexing and integer comparisons. A table is a snapshot: it must be rebuilt if the
+ * attributes of its elements change.
+ * @see AttributeSchema
+ * @see CostProgram
+ */
+class DLL_EXPORT AttributeTable {
+    public:
+        /**
+         * @brief Constructs a new AttributeTable object, filled with the attributes of some elements.
+         * @param schema the schema, which is extended with the new attribute names
+         * @param elements the elements, whose indexes are the rows
+         */
+        template<typename T>
+        AttributeTable(AttributeSchema *schema, const QList<T *> &elements) : schema_(schema), rowCount_(elements.size()) {
+            for(T *element : elements)
+                setRow(element->getIndex(), element);
+        }
+
+        /**
+         * @brief Destructs an AttributeTable object.
+         */
+        ~AttributeTable();
+
+        /**
+         * @brief Returns the schema of the table.
+         * @return the schema
+         */
+        AttributeSchema *getSchema() const;
+
+        /**
+         * @brief Returns the number of rows.
+         * @return the row count
+         */
+        int getRowCount() const;
+
+        /**
+         * @brief Indicates whether an element has a value in a column.
+         * @param column the column
+         * @param row the index of the element
+         * @return a boolean
+         */
+        bool hasValue(int column, int row) const {
+            return column < numeric_.size() && (text_[column][row] >= 0 || !qIsNaN(numeric_[column][row]));
+        }
+
+        /**
+         * @brief Returns a value as a double, i.e. QVariant::toDouble of the original value.
+         * @param column the column
+         * @param row the index of the element
+         * @return the value
+         */
+        double getNumeric(int column, int row) const {
+            return numeric_[column][row];
+        }
+
+        /**
+         * @brief Returns a textual value.
+         * @param column the column
+         * @param row the index of the element
+         * @return the identifier of the value in the ::StringPool, or -1 if the value is not textual
+         */
+        int getText(int column, int row) const {
+            return text_[column][row];
+        }
+
+        /**
+         * @brief Returns the values of a column as doubles, one per row.
+         * @param column the column
+         * @return the values, to be read only if the column is complete
+         */
+        const double *getNumericColumn(int column) const;
+
+        /**
+         * @brief Returns the interned textual values of a column, one per row.
+         * @param column the column
+         * @return the values, to be read only if the column is complete
+         */
+        const int *getTextColumn(int column) const;
+
+        /**
+         * @brief Indicates whether all the elements have a value in a column.
+         * @param column the column
+         * @return a boolean
+         */
+        bool isComplete(int column) const;
+
+        /**
+         * @brief Indicates whether all the values of a column are textual.
+         * @param column the column
+         * @return a boolean
+         */
+        bool isTextual(int column) const;
+
+        /**
+         * @brief Indicates whether none of the values of a column is textual.
+         * @param column the column
+         * @return a boolean
+         */
+        bool isNumerical(int column) const;
+
+        /**
+         * @brief Returns a value as a string, i.e. QVariant::toString of a textual value.
+         * @param column the column
+         * @param row the index of the element
+         * @return the string
+         */
+        QString getString(int column, int row) const;
+
+    private:
+        void setRow(int row, const GraphElement *element);
+
+        AttributeSchema *schema_;
+        int rowCount_;
+
+        /**
+         * @brief The values of each column, NaN for a missing value.
+         */
+        QVector<QVector<double> > numeric_;
+
+        /**
+         * @brief The interned textual values of each column, -1 for a missing or a numeric value.
+         */
+        QVector<QVector<int> > text_;
+
+        /**
+         * @brief The number of values of each column.
+         */
+        QVector<int> valueCount_;
+
+        /**
+         * @brief The number of textual values of each column.
+         */
+        QVector<int> textCount_;
+};
+
+#endif /* GEMPP_ATTRIBUTETABLE_H */
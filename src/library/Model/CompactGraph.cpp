@@ -0,0 +1,77 @@
+#include <algorithm>
+#include "CompactGraph.h"
+
+CompactGraph::CompactGraph(const Graph *graph) : vertexCount_(graph->getVertexCount()), directed_(graph->getType() == Graph::DIRECTED) {
+    int edgeCount = graph->getEdgeCount();
+    origins_ = QVector<int>(edgeCount);
+    targets_ = QVector<int>(edgeCount);
+    for(int e=0; e < edgeCount; ++e) {
+        origins_[e] = graph->getEdge(e)->getOrigin()->getIndex();
+        targets_[e] = graph->getEdge(e)->getTarget()->getIndex();
+    }
+    init();
+}
+
+CompactGraph::CompactGraph(int vertexCount, int edgeCount, const int *origins, const int *targets, bool directed) : vertexCount_(vertexCount), directed_(directed) {
+    origins_ = QVector<int>(edgeCount);
+    targets_ = QVector<int>(edgeCount);
+    std::copy(origins, origins + edgeCount, origins_.begin());
+    std::copy(targets, targets + edgeCount, targets_.begin());
+    init();
+}
+
+void CompactGraph::init() {
+    int edgeCount = origins_.size();
+
+    // Counts the incident edges of each vertex, then fills the rows in increasing order of edge index
+    for(int d=0; d < Vertex::COUNT; ++d)
+        offsets_[d] = QVector<int>(vertexCount_+1, 0);
+    for(int e=0; e < edgeCount; ++e) {
+        ++offsets_[Vertex::EDGE_OUT][origins_[e]+1];
+        ++offsets_[Vertex::EDGE_IN][targets_[e]+1];
+        ++offsets_[Vertex::EDGE_IN_OUT][origins_[e]+1];
+        if(targets_[e] != origins_[e])
+            ++offsets_[Vertex::EDGE_IN_OUT][targets_[e]+1];
+    }
+    QVector<int> next[Vertex::COUNT];
+    for(int d=0; d < Vertex::COUNT; ++d) {
+        for(int v=0; v < vertexCount_; ++v)
+            offsets_[d][v+1] += offsets_[d][v];
+        edges_[d] = QVector<int>(offsets_[d][vertexCount_]);
+        next[d] = offsets_[d];
+    }
+    for(int e=0; e < edgeCount; ++e) {
+        edges_[Vertex::EDGE_OUT][next[Vertex::EDGE_OUT][origins_[e]]++] = e;
+        edges_[Vertex::EDGE_IN][next[Vertex::EDGE_IN][targets_[e]]++] = e;
+        edges_[Vertex::EDGE_IN_OUT][next[Vertex::EDGE_IN_OUT][origins_[e]]++] = e;
+        if(targets_[e] != origins_[e])
+            edges_[Vertex::EDGE_IN_OUT][next[Vertex::EDGE_IN_OUT][targets_[e]]++] = e;
+    }
+}
+
+CompactGraph::~CompactGraph() {}
+
+int CompactGraph::getVertexCount() const {
+    return vertexCount_;
+}
+
+int CompactGraph::getEdgeCount() const {
+    return origins_.size();
+}
+
+bool CompactGraph::isDirected() const {
+    return directed_;
+}
+
+CompactGraph::Range CompactGraph::getEdges(int v, Vertex::Direction d) const {
+    const int *data = edges_[d].constData();
+    return Range(data + offsets_[d][v], data + offsets_[d][v+1]);
+}
+
+int CompactGraph::getEdge(int v, int e, Vertex::Direction d) const {
+    return edges_[d][offsets_[d][v] + e];
+}
+
+int CompactGraph::getDegree(int v) const {
+    return offsets_[Vertex::EDGE_IN_OUT][v+1] - offsets_[Vertex::EDGE_IN_OUT][v];
+}
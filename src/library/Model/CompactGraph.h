@@ -0,0 +1,147 @@
+#ifndef GEMPP_COMPACTGRAPH_H
+#define GEMPP_COMPACTGRAPH_H
+
+#include <QVector>
+#include "Graph.h"
+
+/**
+ * @brief The CompactGraph class is an immutable view of the structure of a ::Graph,
+ * built once and used wherever the edges are iterated many times (e.g. in the formulations).
+ *
+ * The extremities of the edges are stored in contiguous arrays, and the incident edges of
+ * each vertex are stored in compressed sparse row (CSR) arrays, sorted by edge index.
+ * Iterating over the incident edges of a vertex does not allocate anything, unlike
+ * Vertex::getEdges.
+ *
+ * The vertices and edges are designated by their indexes in the ::Graph. A CompactGraph
+ * must be rebuilt if the structure of its ::Graph changes.
+ * @see Graph
+ */
+class DLL_EXPORT CompactGraph {
+    public:
+        /**
+         * @brief The Range class is a contiguous sequence of edge indexes, to be used in range-based loops.
+         */
+        class Range {
+            public:
+                Range(const int *begin, const int *end) : begin_(begin), end_(end) {}
+                const int *begin() const { return begin_; }
+                const int *end() const { return end_; }
+                int size() const { return end_ - begin_; }
+                int operator[](int i) const { return begin_[i]; }
+
+            private:
+                const int *begin_;
+                const int *end_;
+        };
+
+        /**
+         * @brief Constructs a new CompactGraph object from the current structure of a ::Graph.
+         * @param graph the graph
+         */
+        CompactGraph(const Graph *graph);
+
+        /**
+         * @brief Constructs a new CompactGraph object from the arrays of the endpoints of the edges.
+         * @param vertexCount the number of vertices
+         * @param edgeCount the number of edges
+         * @param origins the indexes of the origins of the edges
+         * @param targets the indexes of the targets of the edges
+         * @param directed whether the graph is directed
+         * @see GraphBuilder
+         */
+        CompactGraph(int vertexCount, int edgeCount, const int *origins, const int *targets, bool directed);
+
+        /**
+         * @brief Destructs a CompactGraph object.
+         */
+        ~CompactGraph();
+
+        /**
+         * @brief Returns the number of vertices.
+         * @return the vertex count
+         */
+        int getVertexCount() const;
+
+        /**
+         * @brief Returns the number of edges.
+         * @return the edge count
+         */
+        int getEdgeCount() const;
+
+        /**
+         * @brief Tests if the edges have directions.
+         * @return whether the graph is directed
+         */
+        bool isDirected() const;
+
+        /**
+         * @brief Returns the origin vertex of an edge.
+         * @param e the index of the edge
+         * @return the index of its origin
+         */
+        int getOrigin(int e) const { return origins_[e]; }
+
+        /**
+         * @brief Returns the target vertex of an edge.
+         * @param e the index of the edge
+         * @return the index of its target
+         */
+        int getTarget(int e) const { return targets_[e]; }
+
+        /**
+         * @brief Returns the other extremity of an edge.
+         * @param v the index of one extremity of the edge
+         * @param e the index of the edge
+         * @return the index of the other extremity
+         */
+        int getNeighbour(int v, int e) const { return (origins_[e] == v) ? targets_[e] : origins_[e]; }
+
+        /**
+         * @brief Returns the incident edges of a vertex, in increasing order of index.
+         * A loop appears once in each direction.
+         * @param v the index of the vertex
+         * @param d the direction of the edges
+         * @return the indexes of the edges
+         */
+        Range getEdges(int v, Vertex::Direction d) const;
+
+        /**
+         * @brief Returns an incident edge of a vertex.
+         * @param v the index of the vertex
+         * @param e the rank of the edge among the incident edges
+         * @param d the direction of the edges
+         * @return the index of the edge
+         */
+        int getEdge(int v, int e, Vertex::Direction d) const;
+
+        /**
+         * @brief Returns the number of edges that are incident to or from a vertex.
+         * @param v the index of the vertex
+         * @return the degree
+         */
+        int getDegree(int v) const;
+
+    private:
+        /**
+         * @brief Builds the incident edges of the vertices from the endpoints of the edges.
+         */
+        void init();
+
+        int vertexCount_;
+        bool directed_;
+        QVector<int> origins_;
+        QVector<int> targets_;
+
+        /**
+         * @brief The offsets of the incident edges of each vertex in CompactGraph::edges_, for each direction.
+         */
+        QVector<int> offsets_[Vertex::COUNT];
+
+        /**
+         * @brief The incident edges of the vertices, for each direction.
+         */
+        QVector<int> edges_[Vertex::COUNT];
+};
+
+#endif /* GEMPP_COMPACTGRAPH_H */
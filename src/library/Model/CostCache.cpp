@@ -0,0 +1,111 @@
+#include <QDateTime>
+#include <QSaveFile>
+#include "CostCache.h"
+#include "Problem.h"
+
+CostCache::CostCache(Weights *weights, qint64 maxSize) : storage_(GEMPP_COST_CACHE_ID), weightsHash_(weights->getHash()), maxSize_(maxSize), size_(0) {
+    if(!storage_.exists() && !storage_.create())
+        Exception(QString("Unable to create the cost cache in %1").arg(storage_.getPath()));
+    for(const QFileInfo &info : storage_.getDir().entryInfoList(QStringList("*." GEMPP_COST_EXT), QDir::Files))
+        size_ += info.size();
+}
+
+CostCache::~CostCache() {}
+
+bool CostCache::accepts(const Graph *query, const Graph *target) const {
+    if((qint64) query->getEdgeCount() * target->getEdgeCount() > GEMPP_COST_CACHE_EDGE_PAIRS)
+        return false;
+    const Graph *graphs[2] = {query, target};
+    for(const Graph *graph : graphs) {
+        for(auto v : graph->getVertices())
+            if(v->getGraph())
+                return false;
+        for(auto e : graph->getEdges())
+            if(e->getGraph())
+                return false;
+    }
+    return true;
+}
+
+QByteArray CostCache::getHash(const Graph *graph) {
+    if(!hashes_.contains(graph))
+        hashes_.insert(graph, graph->getHash());
+    return hashes_.value(graph);
+}
+
+QString CostCache::getFilename(const Graph *query, const Graph *target) {
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(getHash(query));
+    hash.addData(getHash(target));
+    hash.addData(weightsHash_);
+    return FileUtils::slashed(storage_.getDir(), QString("%1.%2").arg(QString(hash.result().toHex()), GEMPP_COST_EXT));
+}
+
+CostMatrices *CostCache::find(const Graph *query, const Graph *target) {
+    if(!accepts(query, target))
+        return 0;
+    QMutexLocker locker(&mutex_);
+    QString filename = getFilename(query, target);
+    if(!QFile::exists(filename))
+        return 0;
+
+    QFile *file = new QFile(filename);
+    if(!file->open(QIODevice::ReadOnly)) {
+        // The file is not at fault, e.g. when no descriptor is left, so it is kept
+        delete file;
+        return 0;
+    }
+    CostMatrices *costs;
+    try {
+        costs = new CostMatrices(file);
+    } catch(std::exception &) {
+        // A damaged file is dropped, the costs will be computed and stored again
+        size_ -= QFileInfo(filename).size();
+        QFile::remove(filename);
+        return 0;
+    }
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 10, 0)
+    // The modification time tells which files have been used recently
+    QFile file(filename);
+    if(file.open(QIODevice::ReadWrite))
+        file.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+#endif
+    return costs;
+}
+
+void CostCache::insert(Problem *problem) {
+    if(!accepts(problem->getQuery(), problem->getTarget()))
+        return;
+    QByteArray buffer = CostMatrices::encode(problem);
+
+    QMutexLocker locker(&mutex_);
+    QString filename = getFilename(problem->getQuery(), problem->getTarget());
+    qint64 previous = QFileInfo(filename).exists() ? QFileInfo(filename).size() : 0;
+    // The file appears at once, so that no other run reads it partially written
+    QSaveFile file(filename);
+    if(!file.open(QIODevice::WriteOnly) || file.write(buffer) != buffer.size() || !file.commit())
+        return;
+    size_ += buffer.size() - previous;
+    if(size_ > maxSize_)
+        evict();
+}
+
+qint64 CostCache::getSize() const {
+    QMutexLocker locker(&mutex_);
+    return size_;
+}
+
+void CostCache::evict() {
+    // Other runs may share the cache, so the files are listed again
+    QFileInfoList files = storage_.getDir().entryInfoList(QStringList("*." GEMPP_COST_EXT), QDir::Files, QDir::Time | QDir::Reversed);
+    size_ = 0;
+    for(const QFileInfo &info : files)
+        size_ += info.size();
+    for(const QFileInfo &info : files) {
+        if(size_ <= maxSize_ * 0.9)
+            break;
+        if(QFile::remove(info.filePath()))
+            size_ -= info.size();
+    }
+}
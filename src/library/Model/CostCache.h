@@ -0,0 +1,98 @@
+#ifndef GEMPP_COSTCACHE_H
+#define GEMPP_COSTCACHE_H
+
+#include <QMutex>
+#include "CostMatrices.h"
+#include "Graph.h"
+#include "Core/LocalStorage.h"
+
+/**
+ * @brief The identifier of the ::LocalStorage of the ::CostCache.
+ */
+#define GEMPP_COST_CACHE_ID "costs"
+
+/**
+ * @brief The default maximum size of the ::CostCache, in bytes.
+ */
+#define GEMPP_COST_CACHE_SIZE (Q_INT64_C(1) << 30)
+
+/**
+ * @brief The maximum number of pairs of edges of the problems stored in the ::CostCache.
+ * Storing a problem evaluates all its edge substitution costs, which are otherwise evaluated on demand.
+ */
+#define GEMPP_COST_CACHE_EDGE_PAIRS (Q_INT64_C(1) << 16)
+
+/**
+ * @brief The CostCache class stores the costs of the problems on disk, so that the next runs
+ * matching the same graphs with the same ::Weights read them instead of computing them again.
+ *
+ * The costs are saved as ::CostMatrices files in a ::LocalStorage, whose names are a hash of
+ * the contents of both graphs and of the weights. When the cache exceeds its maximum size,
+ * the least recently used files are removed. The hierarchical graphs are not cached, since
+ * their costs depend on the resolution of subproblems, nor are the pairs of graphs with more
+ * than GEMPP_COST_CACHE_EDGE_PAIRS pairs of edges.
+ *
+ * All the methods are thread-safe.
+ * @see CostMatrices
+ * @see Problem
+ */
+class DLL_EXPORT CostCache {
+    public:
+        /**
+         * @brief Constructs a new CostCache object.
+         * @param weights the weights used to compute the costs, hashed at once
+         * @param maxSize the maximum size of the cache, in bytes
+         */
+        CostCache(Weights *weights, qint64 maxSize = GEMPP_COST_CACHE_SIZE);
+
+        /**
+         * @brief Destructs a CostCache object.
+         */
+        ~CostCache();
+
+        /**
+         * @brief Indicates whether the costs of a pair of graphs may be cached.
+         * @param query the query graph
+         * @param target the target graph
+         * @return a boolean
+         */
+        bool accepts(const Graph *query, const Graph *target) const;
+
+        /**
+         * @brief Retrieves the costs of a pair of graphs.
+         * @param query the query graph
+         * @param target the target graph
+         * @return the costs, mapped from the cache and owned by the caller, or 0 if they are not cached
+         */
+        CostMatrices *find(const Graph *query, const Graph *target);
+
+        /**
+         * @brief Stores the costs of a problem whose costs have been computed.
+         * @param problem the problem
+         */
+        void insert(Problem *problem);
+
+        /**
+         * @brief Returns the size of the files of the cache.
+         * @return the size, in bytes
+         */
+        qint64 getSize() const;
+
+    private:
+        QString getFilename(const Graph *query, const Graph *target);
+        QByteArray getHash(const Graph *graph);
+
+        /**
+         * @brief Removes the least recently used files until the cache fits in 90% of its maximum size.
+         */
+        void evict();
+
+        LocalStorage storage_;
+        QByteArray weightsHash_;
+        QHash<const Graph *, QByteArray> hashes_;
+        qint64 maxSize_;
+        qint64 size_;
+        mutable QMutex mutex_;
+};
+
+#endif /* GEMPP_COSTCACHE_H */
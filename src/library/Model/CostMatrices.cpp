@@ -0,0 +1,157 @@
+#include <cstring>
+#include "CostMatrices.h"
+#include "Problem.h"
+#include "Core/FileUtils.h"
+
+#define GEMPP_COST_MAGIC "GEMPPCST"
+#define GEMPP_COST_VERSION 1
+#define GEMPP_COST_HEADER 32
+
+static QFile *openFile(const QString &filename) {
+    QFile *file = new QFile(filename);
+    if(!file->open(QIODevice::ReadOnly)) {
+        delete file;
+        Exception(QString("Unable to open the cost file %1").arg(filename));
+    }
+    return file;
+}
+
+CostMatrices::CostMatrices(const QString &filename) : CostMatrices(openFile(filename)) {}
+
+CostMatrices::CostMatrices(QFile *file) : file_(file) {
+    // Only the mapping is kept, not the descriptor
+    qint64 size;
+    const char *data = FileUtils::map(*file_, buffer_, size);
+    try {
+        init((const uchar *) data, size);
+    } catch(std::exception &e) {
+        QString filename = file_->fileName();
+        delete file_;
+        Exception(QString("%1: %2").arg(filename, e.what()));
+    }
+}
+
+CostMatrices::CostMatrices(const QByteArray &buffer) : file_(0), buffer_(buffer) {
+    init((const uchar *) buffer_.constData(), buffer_.size());
+}
+
+CostMatrices::~CostMatrices() {
+    // Deleting the file unmaps it
+    delete file_;
+}
+
+void CostMatrices::init(const uchar *data, qint64 size) {
+    if(size < GEMPP_COST_HEADER || memcmp(data, GEMPP_COST_MAGIC, 8))
+        Exception("The buffer does not hold cost matrices");
+    quint32 version, flags;
+    memcpy(&version, data + 8, sizeof(quint32));
+    memcpy(&flags, data + 12, sizeof(quint32));
+    if(version != GEMPP_COST_VERSION)
+        Exception(QString("Version %1 of the cost matrices is not supported").arg(version));
+    single_ = (flags & 1);
+
+    qint32 counts[4];
+    memcpy(counts, data + 16, sizeof(counts));
+    for(int t = 0; t < GraphElement::COUNT; ++t)
+        queryCounts_[t] = targetCounts_[t] = queryCosts_[t] = targetCosts_[t] = substitutions_[t] = 0;
+    queryCounts_[GraphElement::VERTEX] = counts[0];
+    targetCounts_[GraphElement::VERTEX] = counts[1];
+    queryCounts_[GraphElement::EDGE] = counts[2];
+    targetCounts_[GraphElement::EDGE] = counts[3];
+    for(int i=0; i < 4; ++i)
+        if(counts[i] < 0)
+            Exception("The cost matrices have a negative size");
+
+    // The sections follow each other
+    qint64 offset = 0;
+    for(int t = GraphElement::VERTEX; t < GraphElement::COUNT; ++t) {
+        queryCosts_[t] = offset;
+        offset += queryCounts_[t];
+        targetCosts_[t] = offset;
+        offset += targetCounts_[t];
+    }
+    for(int t = GraphElement::VERTEX; t < GraphElement::COUNT; ++t) {
+        substitutions_[t] = offset;
+        offset += (qint64) queryCounts_[t]*targetCounts_[t];
+    }
+    if(size != GEMPP_COST_HEADER + offset*(single_ ? sizeof(float) : sizeof(double)))
+        Exception(QString("The size of the cost matrices is %1 bytes instead of %2").arg(size).arg(GEMPP_COST_HEADER + offset*(single_ ? sizeof(float) : sizeof(double))));
+    values_ = data + GEMPP_COST_HEADER;
+}
+
+double CostMatrices::getValue(qint64 offset) const {
+    return single_ ? ((const float *) values_)[offset] : ((const double *) values_)[offset];
+}
+
+bool CostMatrices::isSinglePrecision() const {
+    return single_;
+}
+
+int CostMatrices::getQueryCount(GraphElement::Type type) const {
+    return queryCounts_[type];
+}
+
+int CostMatrices::getTargetCount(GraphElement::Type type) const {
+    return targetCounts_[type];
+}
+
+double CostMatrices::getQueryCost(GraphElement::Type type, int index) const {
+    return getValue(queryCosts_[type] + index);
+}
+
+double CostMatrices::getTargetCost(GraphElement::Type type, int index) const {
+    return getValue(targetCosts_[type] + index);
+}
+
+template<typename T>
+static void encodeValues(Problem *problem, QByteArray &buffer) {
+    Graph *query = problem->getQuery(), *target = problem->getTarget();
+    int nVQ = query->getVertexCount(), nVT = target->getVertexCount();
+    int nEQ = query->getEdgeCount(), nET = target->getEdgeCount();
+    qint64 count = nVQ + nVT + nEQ + nET + (qint64) nVQ*nVT + (qint64) nEQ*nET;
+    buffer.resize(GEMPP_COST_HEADER + count*sizeof(T));
+    T *values = (T *) (buffer.data() + GEMPP_COST_HEADER);
+
+    for(int i=0; i < nVQ; ++i)
+        *values++ = query->getVertex(i)->getCost();
+    for(int k=0; k < nVT; ++k)
+        *values++ = target->getVertex(k)->getCost();
+    for(int ij=0; ij < nEQ; ++ij)
+        *values++ = query->getEdge(ij)->getCost();
+    for(int kl=0; kl < nET; ++kl)
+        *values++ = target->getEdge(kl)->getCost();
+    for(int i=0; i < nVQ; ++i)
+        for(int k=0; k < nVT; ++k)
+            *values++ = problem->getCost(GraphElement::VERTEX, i, k);
+    for(int ij=0; ij < nEQ; ++ij)
+        for(int kl=0; kl < nET; ++kl)
+            *values++ = problem->getCost(GraphElement::EDGE, ij, kl);
+}
+
+QByteArray CostMatrices::encode(Problem *problem, bool singlePrecision) {
+    QByteArray buffer;
+    if(singlePrecision)
+        encodeValues<float>(problem, buffer);
+    else
+        encodeValues<double>(problem, buffer);
+
+    quint32 version = GEMPP_COST_VERSION, flags = singlePrecision ? 1 : 0;
+    qint32 counts[4] = {problem->getQuery()->getVertexCount(), problem->getTarget()->getVertexCount(),
+                        problem->getQuery()->getEdgeCount(), problem->getTarget()->getEdgeCount()};
+    char *data = buffer.data();
+    memcpy(data, GEMPP_COST_MAGIC, 8);
+    memcpy(data + 8, &version, sizeof(quint32));
+    memcpy(data + 12, &flags, sizeof(quint32));
+    memcpy(data + 16, counts, sizeof(counts));
+    return buffer;
+}
+
+void CostMatrices::save(Problem *problem, const QString &filename, bool singlePrecision) {
+    QFile file(filename);
+    if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        Exception(QString("Unable to write the cost file %1").arg(filename));
+    QByteArray buffer = encode(problem, singlePrecision);
+    if(file.write(buffer) != buffer.size())
+        Exception(QString("Unable to write the cost file %1").arg(filename));
+    file.close();
+}
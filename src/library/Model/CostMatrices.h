@@ -0,0 +1,150 @@
+#ifndef GEMPP_COSTMATRICES_H
+#define GEMPP_COSTMATRICES_H
+
+#include <QByteArray>
+#include <QFile>
+#include "GraphElement.h"
+
+/**
+ * @brief The extension of the files storing some ::CostMatrices.
+ */
+#define GEMPP_COST_EXT "cost"
+
+class Problem;
+
+/**
+ * @brief The CostMatrices class gives access to the precomputed costs of a ::Problem, stored in a
+ * binary buffer, so that a ::Problem may skip the computation of its costs. The buffer is either
+ * a memory mapped file or an in-memory array, and it is read in place.
+ *
+ * The buffer holds, in the native byte order:
+ *  - a header of 32 bytes: the characters "GEMPPCST", the version (uint32, currently 1),
+ *    the flags (uint32, 1 if the values are float32 instead of float64), and the number of
+ *    vertices of the query and the target graphs, then the number of edges of the query and
+ *    the target graphs (int32 each);
+ *  - the creation costs of the query vertices, the target vertices, the query edges, then the
+ *    target edges;
+ *  - the vertex substitution costs, then the edge substitution costs, as row-major matrices
+ *    whose rows are the elements of the query graph.
+ *
+ * The elements are designated by their indexes in the graphs.
+ * @see Problem
+ */
+class DLL_EXPORT CostMatrices {
+    public:
+        /**
+         * @brief Constructs a new CostMatrices object, mapping a file in memory.
+         * @param filename the file
+         * @warning throws an Exception if the file cannot be read or is not valid
+         */
+        CostMatrices(const QString &filename);
+
+        /**
+         * @brief Constructs a new CostMatrices object, mapping a file in memory.
+         * @param file the file, opened for reading, which is owned by the object and closed at once
+         * @warning throws an Exception if the file is not valid, and deletes it
+         */
+        CostMatrices(QFile *file);
+
+        /**
+         * @brief Constructs a new CostMatrices object from an in-memory buffer, which is shared and not copied.
+         * @param buffer the buffer
+         * @warning throws an Exception if the buffer is not valid
+         */
+        CostMatrices(const QByteArray &buffer);
+
+        /**
+         * @brief Destructs a CostMatrices object, unmapping its file.
+         */
+        ~CostMatrices();
+
+        /**
+         * @brief Indicates whether the values are stored as float32.
+         * @return a boolean
+         */
+        bool isSinglePrecision() const;
+
+        /**
+         * @brief Returns the number of elements of the query graph.
+         * @param type the type of the elements
+         * @return the count
+         */
+        int getQueryCount(GraphElement::Type type) const;
+
+        /**
+         * @brief Returns the number of elements of the target graph.
+         * @param type the type of the elements
+         * @return the count
+         */
+        int getTargetCount(GraphElement::Type type) const;
+
+        /**
+         * @brief Returns the creation cost of an element of the query graph.
+         * @param type the type of the element
+         * @param index the index of the element
+         * @return the cost
+         */
+        double getQueryCost(GraphElement::Type type, int index) const;
+
+        /**
+         * @brief Returns the creation cost of an element of the target graph.
+         * @param type the type of the element
+         * @param index the index of the element
+         * @return the cost
+         */
+        double getTargetCost(GraphElement::Type type, int index) const;
+
+        /**
+         * @brief Returns the substitution cost between two elements.
+         * @param type the type of the elements
+         * @param queryIndex the index of the element of the query graph
+         * @param targetIndex the index of the element of the target graph
+         * @return the cost
+         */
+        double getSubstitutionCost(GraphElement::Type type, int queryIndex, int targetIndex) const {
+            qint64 offset = substitutions_[type] + (qint64) queryIndex*targetCounts_[type] + targetIndex;
+            return single_ ? ((const float *) values_)[offset] : ((const double *) values_)[offset];
+        }
+
+        /**
+         * @brief Encodes the costs of a problem whose costs have been computed.
+         * @param problem the problem
+         * @param singlePrecision whether to store the values as float32
+         * @return the buffer
+         */
+        static QByteArray encode(Problem *problem, bool singlePrecision = false);
+
+        /**
+         * @brief Saves the costs of a problem whose costs have been computed to a file.
+         * @param problem the problem
+         * @param filename the file
+         * @param singlePrecision whether to store the values as float32
+         */
+        static void save(Problem *problem, const QString &filename, bool singlePrecision = false);
+
+    private:
+        /**
+         * @brief Reads the header and checks the size of the buffer.
+         * @param data the buffer
+         * @param size the size of the buffer
+         */
+        void init(const uchar *data, qint64 size);
+
+        double getValue(qint64 offset) const;
+
+        QFile *file_;
+        QByteArray buffer_;
+        const void *values_;
+        bool single_;
+        int queryCounts_[GraphElement::COUNT];
+        int targetCounts_[GraphElement::COUNT];
+
+        /**
+         * @brief The offsets, in values, of the sections of the buffer.
+         */
+        qint64 queryCosts_[GraphElement::COUNT];
+        qint64 targetCosts_[GraphElement::COUNT];
+        qint64 substitutions_[GraphElement::COUNT];
+};
+
+#endif /* GEMPP_COSTMATRICES_H */
@@ -0,0 +1,214 @@
+#include "CostProgram.h"
+#include "Weights.h"
+#include "Core/StringPool.h"
+
+CostProgram::CostProgram(const AttributeSchema *schema, double constant, WeightHash::Mode mode, uint root, const QVector<Term> &terms) :
+    schema_(schema), columnCount_(schema->getColumnCount()), constant_(constant), mode_(mode), root_(root), terms_(terms) {}
+
+CostProgram::~CostProgram() {}
+
+void CostProgram::check(const AttributeTable *t1, const AttributeTable *t2) const {
+    if(t1->getSchema() != schema_ || t2->getSchema() != schema_ || schema_->getColumnCount() != columnCount_)
+        Exception(QString("The attribute tables do not match the schema the cost program has been compiled for"));
+}
+
+int CostProgram::findMissingValue(const AttributeTable *t1, const AttributeTable *t2, int *column) const {
+    check(t1, t2);
+    int i, k, c;
+    for(const Term &term : terms_) {
+        c = term.column;
+        if(t2->isComplete(c))
+            continue;
+        for(i=0; i < t1->getRowCount() && !t1->hasValue(c, i); ++i);
+        if(i == t1->getRowCount())
+            continue;
+        for(k=0; t2->hasValue(c, k); ++k);
+        *column = c;
+        return k;
+    }
+    return -1;
+}
+
+static void checkValue(GraphElement *e, const AttributeTable *t, int column) {
+    if(!t->hasValue(column, e->getIndex()))
+        Exception(QString("%1 element \"%2\" has no attribute \"%3\"").arg(GraphElement::toName(e->getType()), e->getID(), StringPool::get(t->getSchema()->getName(column))));
+}
+
+double CostProgram::substitutionCost(GraphElement *e1, GraphElement *e2, const AttributeTable *t1, const AttributeTable *t2) const {
+    if(e1->getType() != e2->getType())
+        Exception(QString("There are no possible substitutions between elements of different types"));
+    check(t1, t2);
+
+    int i = e1->getIndex(), k = e2->getIndex(), c;
+    bool same;
+    // Test if all symbolic attributes of e1 and e2 are the same
+    for(const Term &term : terms_) {
+        c = term.column;
+        if(!t1->hasValue(c, i) || (term.type != Weight::DISCRETE))
+            continue;
+        checkValue(e2, t2, c);
+        if((t1->getText(c, i) >= 0) && (t2->getText(c, k) >= 0))
+            same = (t1->getText(c, i) == t2->getText(c, k));
+        else if((t1->getText(c, i) < 0) && (t2->getText(c, k) < 0))
+            same = (t1->getNumeric(c, i) == t2->getNumeric(c, k));
+        else
+            same = (t1->getString(c, i) == t2->getString(c, k));
+        if(!same)
+            return e1->getCost() + e2->getCost();
+    }
+
+    // e1 and e2 have equal symbolic attributes
+    double total_cost = constant_;
+    double cost;
+    for(const Term &term : terms_) {
+        c = term.column;
+        // Evaluate only non symbolic attributes
+        if(!t1->hasValue(c, i) || (term.type == Weight::DISCRETE))
+            continue;
+
+        cost = 0;
+        switch(term.type) {
+            case Weight::NUMERIC:
+                checkValue(e2, t2, c);
+                cost = t1->getNumeric(c, i) - t2->getNumeric(c, k);
+                break;
+            case Weight::STRING:
+                checkValue(e2, t2, c);
+                if((t1->getText(c, i) >= 0) && (t2->getText(c, k) >= 0))
+                    cost = levenshtein(t1->getText(c, i), t2->getText(c, k));
+                else
+                    cost = levenshtein(t1->getString(c, i), t2->getString(c, k));
+                break;
+            default:
+                break;
+        }
+        cost = ipow(fabs(term.value*cost), term.power);
+        switch(mode_) {
+            case WeightHash::ADD:
+                total_cost += cost;
+                break;
+            case WeightHash::MULTIPLY:
+                total_cost *= cost;
+                break;
+            default:
+                break;
+        }
+    }
+
+    if(root_ > 1)
+        total_cost = pow(total_cost, 1.0/root_);
+
+    return total_cost;
+}
+
+template<unsigned P, WeightHash::Mode M>
+static void accumulate(double w, double a, const double *b, double *total, int n) {
+    // Written without branches nor calls, so that the compiler vectorizes it
+    for(int k=0; k < n; ++k) {
+        if(M == WeightHash::MULTIPLY)
+            total[k] *= ipow<P>(fabs(w*(a - b[k])));
+        else
+            total[k] += ipow<P>(fabs(w*(a - b[k])));
+    }
+}
+
+template<WeightHash::Mode M>
+static void accumulate(uint power, double w, double a, const double *b, double *total, int n) {
+    switch(power) {
+        case 0:
+            accumulate<0, M>(w, a, b, total, n);
+            break;
+        case 1:
+            accumulate<1, M>(w, a, b, total, n);
+            break;
+        case 2:
+            accumulate<2, M>(w, a, b, total, n);
+            break;
+        case 3:
+            accumulate<3, M>(w, a, b, total, n);
+            break;
+        case 4:
+            accumulate<4, M>(w, a, b, total, n);
+            break;
+        default:
+            for(int k=0; k < n; ++k) {
+                if(M == WeightHash::MULTIPLY)
+                    total[k] *= ipow(fabs(w*(a - b[k])), power);
+                else
+                    total[k] += ipow(fabs(w*(a - b[k])), power);
+            }
+            break;
+    }
+}
+
+bool CostProgram::substitutionCosts(GraphElement *e1, const AttributeTable *t1, const AttributeTable *t2, const double *costs2, int begin, int end, double *result) const {
+    check(t1, t2);
+    int i = e1->getIndex(), n = end - begin, k, c;
+    if(n <= 0)
+        return true;
+
+    // Checks that all the columns can be read as arrays
+    for(const Term &term : terms_) {
+        c = term.column;
+        if(!t1->hasValue(c, i))
+            continue;
+        if(!t2->isComplete(c))
+            return false;
+        if((term.type == Weight::DISCRETE) && !((t1->getText(c, i) >= 0) ? t2->isTextual(c) : t2->isNumerical(c)))
+            return false;
+    }
+
+    for(k=0; k < n; ++k)
+        result[k] = constant_;
+    QVector<bool> different(n, false);
+    double cost;
+    for(const Term &term : terms_) {
+        c = term.column;
+        if(!t1->hasValue(c, i))
+            continue;
+        switch(term.type) {
+            case Weight::DISCRETE:
+                if(t1->getText(c, i) >= 0) {
+                    const int *b = t2->getTextColumn(c) + begin;
+                    for(k=0; k < n; ++k)
+                        different[k] = different[k] || (b[k] != t1->getText(c, i));
+                } else {
+                    const double *b = t2->getNumericColumn(c) + begin;
+                    for(k=0; k < n; ++k)
+                        different[k] = different[k] || (b[k] != t1->getNumeric(c, i));
+                }
+                break;
+            case Weight::NUMERIC:
+                if(mode_ == WeightHash::ADD)
+                    accumulate<WeightHash::ADD>(term.power, term.value, t1->getNumeric(c, i), t2->getNumericColumn(c) + begin, result, n);
+                else if(mode_ == WeightHash::MULTIPLY)
+                    accumulate<WeightHash::MULTIPLY>(term.power, term.value, t1->getNumeric(c, i), t2->getNumericColumn(c) + begin, result, n);
+                break;
+            default:
+                for(k=0; k < n; ++k) {
+                    cost = 0;
+                    if(term.type == Weight::STRING) {
+                        // The distances between interned strings are cached
+                        if((t1->getText(c, i) >= 0) && (t2->getText(c, begin + k) >= 0))
+                            cost = levenshtein(t1->getText(c, i), t2->getText(c, begin + k));
+                        else
+                            cost = levenshtein(t1->getString(c, i), t2->getString(c, begin + k));
+                    }
+                    cost = ipow(fabs(term.value*cost), term.power);
+                    if(mode_ == WeightHash::ADD)
+                        result[k] += cost;
+                    else if(mode_ == WeightHash::MULTIPLY)
+                        result[k] *= cost;
+                }
+                break;
+        }
+    }
+
+    for(k=0; k < n; ++k) {
+        if(different[k])
+            result[k] = e1->getCost() + costs2[begin + k];
+        else if(root_ > 1)
+            result[k] = pow(result[k], 1.0/root_);
+    }
+    return true;
+}
@@ -0,0 +1,91 @@
+#ifndef GEMPP_COSTPROGRAM_H
+#define GEMPP_COSTPROGRAM_H
+
+#include "AttributeTable.h"
+#include "WeightHash.h"
+
+/**
+ * @brief The CostProgram class is an immutable snapshot of the substitution ::Weights of the
+ * columns of an ::AttributeSchema, produced by Weights::compile. It holds a flat list of terms
+ * (column, type, weight and power of each attribute) along with the constant weight and the
+ * combination mode and root, so that evaluating the costs involves no hashing nor locking.
+ * A CostProgram may therefore be shared read-only by all the threads computing the costs.
+ *
+ * The costs are the same as Weights::substitutionCost, the attributes being read from the
+ * ::AttributeTable of both graphs, whose schema must be the one of the program.
+ * @see Weights
+ * @see AttributeTable
+ */
+class DLL_EXPORT CostProgram {
+    public:
+        /**
+         * @brief The Term struct is the weight of one column of the schema.
+         */
+        struct Term {
+            int column;         /**< the column of the attribute */
+            Weight::Type type;  /**< the type of the weight */
+            double value;       /**< the weight */
+            uint power;         /**< the power applied to the weighted difference */
+        };
+
+        /**
+         * @brief Constructs a new CostProgram object.
+         * @param schema the schema whose columns are designated by the terms
+         * @param constant the constant weight, already raised to its power
+         * @param mode the combination of the terms
+         * @param root the root applied to the total cost
+         * @param terms the terms of the non symbolic and the symbolic attributes with a non-zero weight, sorted by attribute name
+         */
+        CostProgram(const AttributeSchema *schema, double constant, WeightHash::Mode mode, uint root, const QVector<Term> &terms);
+
+        /**
+         * @brief Destructs a CostProgram object.
+         */
+        ~CostProgram();
+
+        /**
+         * @brief Computes the substitution cost between two elements.
+         * @param e1 the first element
+         * @param e2 the second element
+         * @param t1 the attribute table of the first element
+         * @param t2 the attribute table of the second element
+         * @return the cost
+         */
+        double substitutionCost(GraphElement *e1, GraphElement *e2, const AttributeTable *t1, const AttributeTable *t2) const;
+
+        /**
+         * @brief Computes the substitution costs between an element and a range of elements at once,
+         * column by column. The results are the same as substitutionCost.
+         * @param e1 the first element
+         * @param t1 the attribute table of the first element
+         * @param t2 the attribute table of the other elements
+         * @param costs2 the creation costs of the other elements, indexed as the rows of t2
+         * @param begin the first row of t2
+         * @param end the row of t2 following the last one
+         * @param result the costs, of size end-begin
+         * @return false if a column is missing values or mixes textual and numeric values, in which case nothing is computed
+         */
+        bool substitutionCosts(GraphElement *e1, const AttributeTable *t1, const AttributeTable *t2, const double *costs2, int begin, int end, double *result) const;
+
+        /**
+         * @brief Looks for an element of a table missing a weighted attribute that an element of another table has.
+         * It is stricter than substitutionCost, which only reports the missing attributes it has to read.
+         * @param t1 the attribute table of the first elements
+         * @param t2 the attribute table of the second elements
+         * @param column the column of the missing attribute, if any
+         * @return the row of t2 missing the attribute, or -1 if there is none
+         */
+        int findMissingValue(const AttributeTable *t1, const AttributeTable *t2, int *column) const;
+
+    private:
+        void check(const AttributeTable *t1, const AttributeTable *t2) const;
+
+        const AttributeSchema *schema_;
+        int columnCount_;
+        double constant_;
+        WeightHash::Mode mode_;
+        uint root_;
+        QVector<Term> terms_;
+};
+
+#endif /* GEMPP_COSTPROGRAM_H */
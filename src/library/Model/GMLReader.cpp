@@ -0,0 +1,265 @@
+#include <climits>
+#include <cstring>
+#include "GMLReader.h"
+#include "Core/FileUtils.h"
+
+GMLReader::GMLReader(const QString &filename) : filename_(filename), file_(new QFile(filename)), data_(0) {
+    if(!file_->open(QIODevice::ReadOnly)) {
+        delete file_;
+        Exception(QString("Unable to open the graph file %1").arg(filename));
+    }
+    qint64 size;
+    data_ = FileUtils::map(*file_, buffer_, size);
+    end_ = data_ + size;
+    position_ = tokenBegin_ = tokenEnd_ = data_;
+}
+
+GMLReader::~GMLReader() {
+    // Deleting the file unmaps it
+    delete file_;
+}
+
+static bool isSpace(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\f' || c == '\v';
+}
+
+static bool parseInt(const char *begin, const char *end, int *value) {
+    const char *p = begin;
+    bool negative = false;
+    qint64 result = 0;
+    if(p < end && (*p == '-' || *p == '+'))
+        negative = (*p++ == '-');
+    if(p == end)
+        return false;
+    for(; p < end; ++p) {
+        if(*p < '0' || *p > '9')
+            return false;
+        result = result*10 + (*p - '0');
+        if(result > (qint64) INT_MAX + 1)
+            return false;
+    }
+    if(negative)
+        result = -result;
+    if(result > INT_MAX)
+        return false;
+    *value = (int) result;
+    return true;
+}
+
+GMLReader::Token GMLReader::next() {
+    // Skip the blanks and the comment lines
+    while(position_ < end_) {
+        if(isSpace(*position_)) {
+            ++position_;
+        } else if(*position_ == '#') {
+            while(position_ < end_ && *position_ != '\n')
+                ++position_;
+        } else {
+            break;
+        }
+    }
+    tokenBegin_ = position_;
+    if(position_ == end_) {
+        tokenEnd_ = position_;
+        return END;
+    }
+    switch(*position_) {
+        case '[':
+            tokenEnd_ = ++position_;
+            return OPEN;
+        case ']':
+            tokenEnd_ = ++position_;
+            return CLOSE;
+        case '"':
+            ++position_;
+            while(position_ < end_ && *position_ != '"')
+                ++position_;
+            if(position_ == end_)
+                Exception(error("Unterminated string"));
+            tokenEnd_ = ++position_;
+            return STRING;
+        default:
+            while(position_ < end_ && !isSpace(*position_) && *position_ != '[' && *position_ != ']')
+                ++position_;
+            tokenEnd_ = position_;
+            return WORD;
+    }
+}
+
+void GMLReader::skip(Token token) {
+    int depth = (token == OPEN) ? 1 : 0;
+    while(depth > 0) {
+        switch(next()) {
+            case OPEN:
+                ++depth;
+                break;
+            case CLOSE:
+                --depth;
+                break;
+            case END:
+                Exception(error("Unterminated list"));
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+bool GMLReader::is(const char *key) const {
+    uint length = strlen(key);
+    return (uint) (tokenEnd_ - tokenBegin_) == length && !qstrnicmp(tokenBegin_, key, length);
+}
+
+QString GMLReader::getText() const {
+    return QString::fromUtf8(tokenBegin_, tokenEnd_ - tokenBegin_);
+}
+
+QString GMLReader::getName(const char *begin, const char *end) {
+    QByteArray raw = QByteArray::fromRawData(begin, end - begin);
+    auto it = names_.constFind(raw);
+    if(it != names_.constEnd())
+        return it.value();
+    QString name = QString::fromUtf8(begin, end - begin);
+    names_.insert(QByteArray(begin, end - begin), name);
+    return name;
+}
+
+QString GMLReader::error(const QString &message) const {
+    return QString("%1 in %2 at byte %3").arg(message, filename_).arg(tokenBegin_ - data_);
+}
+
+void GMLReader::readElement(GraphElement *element, const char *const *keys, int keyCount, QString *values) {
+    const char *keyBegin, *keyEnd;
+    int value, k;
+    Token token;
+    while((token = next()) != CLOSE) {
+        if(token != WORD)
+            Exception(error("Expected a key"));
+        keyBegin = tokenBegin_;
+        keyEnd = tokenEnd_;
+        for(k = 0; k < keyCount && !is(keys[k]); ++k);
+        bool comment = is("comment");
+
+        token = next();
+        if(token == OPEN) {
+            skip(token);
+            continue;
+        }
+        if(token != WORD && token != STRING)
+            Exception(error("Expected a value"));
+        if(k < keyCount) {
+            values[k] = getText();
+        } else if(!comment) {
+            // The numbers are parsed from the buffer, only the strings are copied
+            QString name = getName(keyBegin, keyEnd);
+            int length = tokenEnd_ - tokenBegin_;
+            if(token == STRING)
+                element->addAttribute(name, QMetaType::QString, getText());
+            else if(memchr(tokenBegin_, '.', length))
+                element->addAttribute(name, QMetaType::Double, QByteArray::fromRawData(tokenBegin_, length).toDouble());
+            else if(parseInt(tokenBegin_, tokenEnd_, &value))
+                element->addAttribute(name, QMetaType::Int, value);
+            else if(memchr(tokenBegin_, 'e', length) || memchr(tokenBegin_, 'E', length)) {
+                bool ok;
+                double number = QByteArray::fromRawData(tokenBegin_, length).toDouble(&ok);
+                if(ok)
+                    element->addAttribute(name, QMetaType::Double, number);
+                else
+                    element->addAttribute(name, QMetaType::Int, 0);
+            } else
+                element->addAttribute(name, QMetaType::Int, 0);
+        }
+    }
+}
+
+void GMLReader::read(Graph *graph) {
+    static const char *const vertexKeys[] = {"id", "label"};
+    static const char *const edgeKeys[] = {"source", "target", "label"};
+    QString values[3];
+    QList<Edge *> edges;
+    QList<QPair<QString, QString> > ends;
+    Vertex *v = 0;
+    Edge *e = 0;
+    Token token;
+    bool found = false, isVertex, isEdge;
+    int directed;
+
+    // Only the first graph of the file is read
+    while(!found && (token = next()) != END) {
+        if(token != WORD)
+            Exception(error("Expected a key"));
+        found = is("graph");
+        token = next();
+        if(!found || token != OPEN) {
+            found = false;
+            skip(token);
+        }
+    }
+    if(!found)
+        Exception(error("No graph found"));
+
+    try {
+        while((token = next()) != CLOSE) {
+            if(token != WORD)
+                Exception(error("Expected a key"));
+            if(is("directed")) {
+                token = next();
+                if(token == WORD && parseInt(tokenBegin_, tokenEnd_, &directed))
+                    graph->setType(directed ? Graph::DIRECTED : Graph::UNDIRECTED);
+                else
+                    skip(token);
+                continue;
+            }
+            isVertex = is(GraphElement::typeName[GraphElement::VERTEX]);
+            isEdge = is(GraphElement::typeName[GraphElement::EDGE]);
+            token = next();
+            if(token != OPEN || (!isVertex && !isEdge)) {
+                skip(token);
+                continue;
+            }
+
+            values[0] = values[1] = values[2] = QString();
+            if(isVertex) {
+                v = new Vertex();
+                readElement(v, vertexKeys, 2, values);
+                values[1].remove('"');
+                if(!values[1].isEmpty())
+                    v->setID(values[1]);
+                graph->addVertex(v, values[0]);
+                v = 0;
+            } else {
+                e = new Edge();
+                readElement(e, edgeKeys, 3, values);
+                values[2].remove('"');
+                if(!values[2].isEmpty())
+                    e->setID(values[2]);
+                edges.append(e);
+                ends.append(qMakePair(values[0], values[1]));
+                e = 0;
+            }
+        }
+    } catch(std::exception &) {
+        if(v)
+            delete v;
+        if(e)
+            delete e;
+        qDeleteAll(edges);
+        throw;
+    }
+
+    // The edges are added once all the vertices are known
+    for(int ij=0; ij < edges.size(); ++ij) {
+        e = edges[ij];
+        e->setOrigin(graph->getVertex(ends[ij].first));
+        e->setTarget(graph->getVertex(ends[ij].second));
+        if(!e->getOrigin() || !e->getTarget()) {
+            qDeleteAll(edges.mid(ij));
+            Exception(QString("The edge %1 of %2 joins unknown vertices %3 and %4").arg(ij).arg(filename_, ends[ij].first, ends[ij].second));
+        }
+        // e may be deleted
+        graph->addEdge(e);
+        e = graph->getEdges().last();
+        e->getOrigin()->addEdge(e, Vertex::EDGE_OUT);
+        e->getTarget()->addEdge(e, Vertex::EDGE_IN);
+    }
+}
@@ -0,0 +1,102 @@
+#ifndef GEMPP_GMLREADER_H
+#define GEMPP_GMLREADER_H
+
+#include <QByteArray>
+#include <QFile>
+#include <QHash>
+#include "Graph.h"
+
+/**
+ * @brief The GMLReader class reads a ::Graph from a GML file in a single pass. The file is mapped
+ * in memory when possible, and tokenized in place: the numbers are parsed from the mapped bytes and
+ * only the textual values are copied. The lists which are not vertices or edges, e.g. graphics, may
+ * be nested and are skipped.
+ *
+ * The keys id, label, source and target have the same meaning as in Graph::print, the comments are
+ * ignored, and any other key becomes an attribute: a textual one when its value is quoted (with the
+ * quotes), a floating point one when it has a decimal point or an exponent, an integer one otherwise.
+ * @see Graph
+ */
+class DLL_EXPORT GMLReader {
+    public:
+        /**
+         * @brief Constructs a new GMLReader object.
+         * @param filename the GML file
+         */
+        GMLReader(const QString &filename);
+
+        /**
+         * @brief Destructs a GMLReader object, unmapping its file.
+         */
+        ~GMLReader();
+
+        /**
+         * @brief Reads the vertices and edges of the file into a graph.
+         * @param graph the graph, which should be empty
+         */
+        void read(Graph *graph);
+
+    private:
+        /**
+         * @brief The kinds of tokens of the GML syntax.
+         */
+        enum Token {
+            END = 0, /**< the end of the file */
+            OPEN, /**< the beginning of a list */
+            CLOSE, /**< the end of a list */
+            STRING, /**< a quoted string */
+            WORD /**< a key or an unquoted value */
+        };
+
+        /**
+         * @brief Reads the next token, whose bounds are kept in GMLReader::tokenBegin_ and GMLReader::tokenEnd_.
+         * @return the kind of the token
+         */
+        Token next();
+
+        /**
+         * @brief Skips the value of a key, which may be a list.
+         * @param token the first token of the value
+         */
+        void skip(Token token);
+
+        /**
+         * @brief Reads a vertex or an edge, whose list has just been opened.
+         * @param element the element
+         * @param keys the lowercase keys which are not attributes
+         * @param keyCount the number of keys
+         * @param values the values of the keys, as written in the file
+         */
+        void readElement(GraphElement *element, const char *const *keys, int keyCount, QString *values);
+
+        /**
+         * @brief Compares the current token with a lowercase key, ignoring the case.
+         * @param key the key
+         * @return a boolean
+         */
+        bool is(const char *key) const;
+
+        QString getText() const;
+        QString getName(const char *begin, const char *end);
+        QString error(const QString &message) const;
+
+        QString filename_;
+        QFile *file_;
+        QByteArray buffer_;
+        const char *data_;
+        const char *end_;
+
+        /**
+         * @brief The current position, and the bounds of the current token.
+         */
+        const char *position_;
+        const char *tokenBegin_;
+        const char *tokenEnd_;
+
+        /**
+         * @brief The names of the attributes, so that each one is decoded once.
+         */
+        QHash<QByteArray, QString> names_;
+};
+
+#endif /* GEMPP_GMLREADER_H */
@@ -0,0 +1,139 @@
+#include "GXLReader.h"
+#include "Core/FileUtils.h"
+
+GXLReader::GXLReader(const QString &filename) : file_(filename) {
+    FileUtils::checkExists(filename);
+    FileUtils::open(file_, QFile::ReadOnly);
+    xml_.setDevice(&file_);
+}
+
+GXLReader::~GXLReader() {
+    if(file_.isOpen())
+        FileUtils::close(file_);
+}
+
+bool GXLReader::read(Graph *graph) {
+    try {
+        // The graph is the first graph element under the root
+        bool found = false;
+        if(xml_.readNextStartElement()) {
+            while(!found && xml_.readNextStartElement()) {
+                if(xml_.name() == GraphElement::typeName[GraphElement::GRAPH]) {
+                    readGraph(graph);
+                    found = true;
+                } else {
+                    xml_.skipCurrentElement();
+                }
+            }
+        }
+        // The DOM ignores the whole document if any part of it is malformed
+        while(!xml_.atEnd())
+            xml_.readNext();
+        if(!found || xml_.hasError())
+            Exception(xml_.errorString());
+    } catch(std::exception &) {
+        qDeleteAll(subgraphs_);
+        subgraphs_.clear();
+        return false;
+    }
+    return true;
+}
+
+void GXLReader::readGraph(Graph *graph) {
+    QXmlStreamAttributes attributes = xml_.attributes();
+    if(attributes.hasAttribute("id"))
+        graph->setID(attributes.value("id").toString());
+    graph->setType(Graph::toType(attributes.value("edgemode").toString()));
+    bool edgeids = Attribute::toVariant(QMetaType::Bool, attributes.hasAttribute("edgeids") ? attributes.value("edgeids").toString() : "false").toBool();
+
+    QList<Edge *> edges;
+    QList<QPair<QString, QString> > ends;
+    Vertex *v;
+    Edge *e;
+    Graph *g;
+    QString id;
+    try {
+        while(xml_.readNextStartElement()) {
+            if(xml_.name() == "attr") {
+                readAttribute(graph);
+            } else if(xml_.name() == GraphElement::typeName[GraphElement::VERTEX]) {
+                v = new Vertex();
+                id = xml_.attributes().value("id").toString();
+                try {
+                    g = readElement(v);
+                } catch(std::exception &) {
+                    delete v;
+                    throw;
+                }
+                if(g)
+                    v->setGraph(g);
+                graph->addVertex(v, id);
+                if(g)
+                    g->setID(QString("%1_v%2").arg(graph->getID(), v->getID()));
+            } else if(xml_.name() == GraphElement::typeName[GraphElement::EDGE]) {
+                // The edges are added once all the vertices are known, as with the DOM
+                e = new Edge();
+                edges.append(e);
+                ends.append(qMakePair(xml_.attributes().value("from").toString(), xml_.attributes().value("to").toString()));
+                id = xml_.attributes().value("id").toString();
+                g = readElement(e);
+                if(edgeids)
+                    e->setID(id);
+                if(g)
+                    e->setGraph(g);
+            } else {
+                xml_.skipCurrentElement();
+            }
+        }
+        if(xml_.hasError())
+            Exception(xml_.errorString());
+        for(int ij=0; ij < ends.size(); ++ij)
+            if(!graph->getVertex(ends[ij].first) || !graph->getVertex(ends[ij].second))
+                Exception(QString("The edge %1 joins unknown vertices").arg(ij));
+    } catch(std::exception &) {
+        qDeleteAll(edges);
+        throw;
+    }
+
+    for(int ij=0; ij < edges.size(); ++ij) {
+        e = edges[ij];
+        e->setOrigin(graph->getVertex(ends[ij].first));
+        e->setTarget(graph->getVertex(ends[ij].second));
+        graph->addEdge(e);
+        // e may be deleted
+        e = graph->getEdges().last();
+        e->getOrigin()->addEdge(e, Vertex::EDGE_OUT);
+        e->getTarget()->addEdge(e, Vertex::EDGE_IN);
+        if(e->getGraph())
+            e->getGraph()->setID(QString("%1_e%2").arg(graph->getID(), e->getID()));
+    }
+}
+
+Graph *GXLReader::readElement(GraphElement *element) {
+    Graph *subgraph = 0;
+    while(xml_.readNextStartElement()) {
+        if(xml_.name() == "attr") {
+            readAttribute(element);
+        } else if(!subgraph && xml_.name() == GraphElement::typeName[GraphElement::GRAPH]) {
+            subgraph = new Graph();
+            subgraphs_.append(subgraph);
+            readGraph(subgraph);
+        } else {
+            xml_.skipCurrentElement();
+        }
+    }
+    if(xml_.hasError())
+        Exception(xml_.errorString());
+    return subgraph;
+}
+
+void GXLReader::readAttribute(GraphElement *element) {
+    QString name = xml_.attributes().value("name").toString();
+    if(!xml_.readNextStartElement())
+        Exception(QString("The attribute %1 has no value").arg(name));
+    QMetaType::Type type = Attribute::toType(xml_.name().toString().toLower());
+    QString text = xml_.readElementText(QXmlStreamReader::IncludeChildElements);
+    element->addAttribute(name, type, Attribute::toVariant(type, text));
+    // As with the DOM, only the first child of the attribute is read
+    xml_.skipCurrentElement();
+}
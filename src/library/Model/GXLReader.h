@@ -0,0 +1,69 @@
+#ifndef GEMPP_GXLREADER_H
+#define GEMPP_GXLREADER_H
+
+#include <QFile>
+#include <QXmlStreamReader>
+#include "Graph.h"
+
+/**
+ * @brief The GXLReader class reads a ::Graph from a GXL file in a single pass with a
+ * QXmlStreamReader, without building the whole document in memory as Graph::load(QDomElement) does.
+ * The vertices and edges are built as soon as they are read, and the hierarchical graphs nested
+ * in the vertices and edges are read recursively.
+ *
+ * The reader gives up on the files it does not handle the same way as the DOM, e.g. malformed
+ * documents or edges joining unknown vertices; such files are read again with the DOM.
+ * @see Graph
+ */
+class DLL_EXPORT GXLReader {
+    public:
+        /**
+         * @brief Constructs a new GXLReader object.
+         * @param filename the GXL file
+         */
+        GXLReader(const QString &filename);
+
+        /**
+         * @brief Destructs a GXLReader object.
+         */
+        ~GXLReader();
+
+        /**
+         * @brief Reads the first graph of the file.
+         * @param graph the graph, which should be empty
+         * @return whether the graph has been read, otherwise the vertices and edges which have been
+         * added to the graph must be removed, and the file read with the DOM
+         */
+        bool read(Graph *graph);
+
+    private:
+        /**
+         * @brief Reads a graph, whose element has just been opened.
+         * @param graph the graph
+         */
+        void readGraph(Graph *graph);
+
+        /**
+         * @brief Reads the attributes and the first nested graph of a vertex or an edge,
+         * whose element has just been opened.
+         * @param element the vertex or the edge
+         * @return the nested graph, or 0 if there is none
+         */
+        Graph *readElement(GraphElement *element);
+
+        /**
+         * @brief Reads an attribute, whose element has just been opened.
+         * @param element the element owning the attribute
+         */
+        void readAttribute(GraphElement *element);
+
+        QFile file_;
+        QXmlStreamReader xml_;
+
+        /**
+         * @brief The nested graphs which have been created, deleted if the file cannot be read.
+         */
+        QList<Graph *> subgraphs_;
+};
+
+#endif /* GEMPP_GXLREADER_H */
@@ -1,4 +1,10 @@
+#include <algorithm>
+#include <QCryptographicHash>
 #include "Graph.h"
+#include "GMLReader.h"
+#include "GXLReader.h"
+#include "GraphView.h"
+#include "Core/StringPool.h"
 
 const char *Graph::typeName[Graph::TYPE_COUNT] = {
     "directed",
@@ -37,7 +43,10 @@ QString Graph::toName(Format format) {
 
 Graph::Graph(Type type): GraphElement(GraphElement::GRAPH) {
     type_ = type;
+    editing_ = false;
     metadata_ = new Metadata();
+    for(int t = 0; t <= GraphElement::COUNT; ++t)
+        terminalsRevision_[t] = -1;
 }
 
 Graph::Graph(const QString &filename) : Graph() {
@@ -51,31 +60,61 @@ Graph::~Graph() {
         delete it;
 }
 
+void Graph::clear() {
+    for(auto it: vertices_)
+        delete it;
+    for(auto it: edges_)
+        delete it;
+    vertices_.clear();
+    verticesInsertionOrder_.clear();
+    vertexKeys_.clear();
+    edges_.clear();
+    removed_.clear();
+    invalidateTerminals();
+}
+
 const QList <Vertex *> &Graph::getVertices() const {
     return vertices_;
 }
 
-QList<GraphElement *> Graph::getTerminals(GraphElement::Type type) const {
-    QList<GraphElement *> result;
+QAtomicInt Graph::revision_(0);
+
+QVector<GraphElement *> Graph::getTerminals(GraphElement::Type type) const {
+    QMutexLocker locker(&terminalsMutex_);
+    int revision = revision_.load();
+    if(terminalsRevision_[type] == revision)
+        return terminals_[type];
+
+    QVector<GraphElement *> &result = terminals_[type];
+    result.clear();
     if(type == GraphElement::VERTEX || type == GraphElement::COUNT) {
         for(auto v : vertices_) {
+            if(removed_.contains(v))
+                continue;
             if(v->getGraph())
-                result.append(v->getGraph()->getTerminals(type));
+                result += v->getGraph()->getTerminals(type);
             else
                 result.append(v);
         }
     }
     if(type == GraphElement::EDGE || type == GraphElement::COUNT) {
         for(auto e : edges_) {
+            if(removed_.contains(e))
+                continue;
             if(e->getGraph())
-                result.append(e->getGraph()->getTerminals(type));
+                result += e->getGraph()->getTerminals(type);
             else
                 result.append(e);
         }
     }
+    terminalsRevision_[type] = revision;
     return result;
 }
 
+void Graph::invalidateTerminals() {
+    revision_.fetchAndAddOrdered(1);
+}
+
 Vertex *Graph::getVertex(int i) const {
     return vertices_[i];
 }
@@ -92,11 +131,15 @@ void Graph::addVertex(Vertex *v, QString id) {
     if(v->getID().isEmpty())
         v->setID(sid);
     verticesInsertionOrder_.insert(sid,vertices_.size());
+    vertexKeys_.append(sid);
     vertices_.push_back(v);
+    invalidateTerminals();
 }
 
 void Graph::removeVertex(QString id) {
-    removeVertex(verticesInsertionOrder_[id]);
+    if(!verticesInsertionOrder_.contains(id))
+        Exception(QString("The graph %1 has no vertex %2").arg(getID(), id));
+    removeVertex(verticesInsertionOrder_.value(id));
 }
 
 void Graph::removeVertex(int index) {
@@ -105,19 +148,23 @@ void Graph::removeVertex(int index) {
 
 void Graph::removeVertex(Vertex *v) {
     int index = v->getIndex();
-    QString key;
-    if(vertices_[index] != v)
+    if(vertices_[index] != v || removed_.contains(v))
         Exception(QString("Index mismatch in vertices of the graph %1").arg(getID()));
 
+    invalidateTerminals();
     // Remove the references
+    verticesInsertionOrder_.remove(vertexKeys_[index]);
+    if(editing_) {
+        removed_.insert(v);
+        return;
+    }
     vertices_.removeAt(index);
-    verticesInsertionOrder_.remove(verticesInsertionOrder_.key(index));
+    vertexKeys_.removeAt(index);
 
     // Reindex the vertices
     for(int i=index; i < vertices_.size(); ++i) {
         vertices_[i]->setIndex(i);
-        key = verticesInsertionOrder_.key(i+1);
-        verticesInsertionOrder_[key] = i;
+        verticesInsertionOrder_[vertexKeys_[i]] = i;
     }
 }
 
@@ -132,6 +179,7 @@ Edge *Graph::getEdge(int i) const {
 void Graph::addEdge(Edge *e) {
     e->setIndex(edges_.size());
     edges_.push_back(e);
+    invalidateTerminals();
 }
 
 void Graph::removeEdge(int index) {
@@ -140,19 +188,70 @@ void Graph::removeEdge(int index) {
 
 void Graph::removeEdge(Edge *e) {
     int index = e->getIndex();
-    if(edges_[index] != e)
+    if(edges_[index] != e || removed_.contains(e))
         Exception(QString("Index mismatch in edges of the graph %1").arg(getID()));
 
+    invalidateTerminals();
     // Remove the references
-    edges_.removeAt(index);
     e->getOrigin()->removeEdge(e);
     e->getTarget()->removeEdge(e);
+    if(editing_) {
+        removed_.insert(e);
+        return;
+    }
+    edges_.removeAt(index);
 
     // Reindex the edges
     for(int i=index; i < edges_.size(); ++i)
         edges_[i]->setIndex(i);
 }
 
+void Graph::beginEdit() {
+    editing_ = true;
+}
+
+void Graph::commitEdit() {
+    editing_ = false;
+    if(removed_.isEmpty())
+        return;
+
+    // Compact the vertices
+    QList<Vertex *> vertices;
+    QStringList keys;
+    vertices.reserve(vertices_.size());
+    keys.reserve(vertices_.size());
+    for(int i=0; i < vertices_.size(); ++i) {
+        if(removed_.contains(vertices_[i]))
+            continue;
+        vertices_[i]->setIndex(vertices.size());
+        verticesInsertionOrder_[vertexKeys_[i]] = vertices.size();
+        vertices.append(vertices_[i]);
+        keys.append(vertexKeys_[i]);
+    }
+    vertices_ = vertices;
+    vertexKeys_ = keys;
+
+    // Compact the edges
+    QList<Edge *> edges;
+    edges.reserve(edges_.size());
+    for(auto e : edges_) {
+        if(removed_.contains(e))
+            continue;
+        e->setIndex(edges.size());
+        edges.append(e);
+    }
+    edges_ = edges;
+    removed_.clear();
+}
+
+bool Graph::isEditing() const {
+    return editing_;
+}
+
+bool Graph::isRemoved(GraphElement *element) const {
+    return removed_.contains(element);
+}
+
 Metadata *Graph::getMetadata() const {
     return metadata_;
 }
@@ -197,122 +296,344 @@ void Graph::computeCosts(Weights *weights) {
     setCost(total);
 }
 
+static void hashElement(QCryptographicHash &hash, const GraphElement *element) {
+    const Attribute *att;
+    int type;
+    double number;
+    hash.addData(QByteArray::number(element->getAttributeCount()));
+    for(int rank = 0; rank < element->getAttributeCount(); ++rank) {
+        att = element->getAttribute(rank);
+        type = att->getType();
+        hash.addData(StringPool::get(element->getAttributeID(rank)).toUtf8());
+        hash.addData((const char *) &type, sizeof(int));
+        if(att->isTextBased()) {
+            hash.addData(att->getValue().toString().toUtf8());
+        } else {
+            number = att->getValue().toDouble();
+            hash.addData((const char *) &number, sizeof(double));
+        }
+    }
+    if(element->getGraph())
+        hash.addData(element->getGraph()->getHash());
+}
+
+QByteArray Graph::getHash() const {
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    int index;
+    hash.addData(QByteArray::number(type_));
+    hash.addData(QByteArray::number(vertices_.size()));
+    for(auto v : vertices_)
+        hashElement(hash, v);
+    hash.addData(QByteArray::number(edges_.size()));
+    for(auto e : edges_) {
+        index = e->getOrigin()->getIndex();
+        hash.addData((const char *) &index, sizeof(int));
+        index = e->getTarget()->getIndex();
+        hash.addData((const char *) &index, sizeof(int));
+        hashElement(hash, e);
+    }
+    return hash.result();
+}
+
+static int countColors(const QVector<QByteArray> &colors) {
+    QSet<QByteArray> distinct;
+    for(const QByteArray &color : colors)
+        distinct.insert(color);
+    return distinct.size();
+}
+
+static int findComponent(QVector<int> &parents, int i) {
+    while(parents[i] != i)
+        i = parents[i] = parents[parents[i]];
+    return i;
+}
+
+void Graph::refineColors(QVector<QByteArray> &colors, QVector<QByteArray> &eColors) const {
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    int n = vertices_.size();
+    bool directed = (type_ == DIRECTED);
+    QVector<QByteArray> refined(n);
+    colors = QVector<QByteArray>(n);
+    eColors = QVector<QByteArray>(edges_.size());
+
+    // The initial colours are the attributes of the elements
+    for(int i=0; i < n; ++i) {
+        hash.reset();
+        hashElement(hash, vertices_[i]);
+        colors[i] = hash.result();
+    }
+    for(auto e : edges_) {
+        hash.reset();
+        hashElement(hash, e);
+        eColors[e->getIndex()] = hash.result();
+    }
+
+    // Each round adds the colours of the neighbourhood, until no class of vertices is split
+    QList<QByteArray> neighbourhood;
+    int classes = countColors(colors), count;
+    for(int round=0; round < n; ++round) {
+        for(int i=0; i < n; ++i) {
+            neighbourhood.clear();
+            for(auto e : vertices_[i]->getEdges(Vertex::EDGE_OUT))
+                neighbourhood.append(QByteArray(directed ? "o" : "u") + eColors[e->getIndex()] + colors[e->getTarget()->getIndex()]);
+            for(auto e : vertices_[i]->getEdges(Vertex::EDGE_IN))
+                neighbourhood.append(QByteArray(directed ? "i" : "u") + eColors[e->getIndex()] + colors[e->getOrigin()->getIndex()]);
+            std::sort(neighbourhood.begin(), neighbourhood.end());
+            hash.reset();
+            hash.addData(colors[i]);
+            for(const QByteArray &neighbour : neighbourhood)
+                hash.addData(neighbour);
+            refined[i] = hash.result();
+        }
+        colors.swap(refined);
+        count = countColors(colors);
+        if(count == classes)
+            break;
+        classes = count;
+    }
+}
+
+QByteArray Graph::getCanonicalHash() const {
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    int n = vertices_.size();
+    bool directed = (type_ == DIRECTED);
+    QVector<QByteArray> colors, eColors;
+    refineColors(colors, eColors);
+
+    // The edges are described by their colours and the ones of their ends
+    QList<QByteArray> vList = colors.toList(), eList;
+    QByteArray origin, target;
+    for(auto e : edges_) {
+        origin = colors[e->getOrigin()->getIndex()];
+        target = colors[e->getTarget()->getIndex()];
+        if(!directed && target < origin)
+            qSwap(origin, target);
+        eList.append(eColors[e->getIndex()] + origin + target);
+    }
+    std::sort(vList.begin(), vList.end());
+    std::sort(eList.begin(), eList.end());
+
+    // The sizes of the connected components tell apart some regular graphs that share the same colours
+    QVector<int> parents(n), sizes(n, 0);
+    for(int i=0; i < n; ++i)
+        parents[i] = i;
+    for(auto e : edges_)
+        parents[findComponent(parents, e->getOrigin()->getIndex())] = findComponent(parents, e->getTarget()->getIndex());
+    for(int i=0; i < n; ++i)
+        ++sizes[findComponent(parents, i)];
+    std::sort(sizes.begin(), sizes.end());
+
+    hash.reset();
+    hash.addData(QByteArray::number(type_));
+    hash.addData(QByteArray::number(n));
+    for(const QByteArray &color : vList)
+        hash.addData(color);
+    hash.addData(QByteArray::number(edges_.size()));
+    for(const QByteArray &color : eList)
+        hash.addData(color);
+    hash.addData((const char *) sizes.constData(), n*sizeof(int));
+    return hash.result();
+}
+
+typedef QHash<QPair<int, int>, QList<QByteArray> > ColorAdjacency;
+
+static ColorAdjacency colorAdjacency(const QList<Edge *> &edges, const QVector<QByteArray> &eColors, bool directed) {
+    ColorAdjacency adjacency;
+    int o, t;
+    for(auto e : edges) {
+        o = e->getOrigin()->getIndex();
+        t = e->getTarget()->getIndex();
+        if(!directed && t < o)
+            qSwap(o, t);
+        adjacency[qMakePair(o, t)].append(eColors[e->getIndex()]);
+    }
+    for(auto it = adjacency.begin(); it != adjacency.end(); ++it)
+        std::sort(it.value().begin(), it.value().end());
+    return adjacency;
+}
+
+static QList<QByteArray> colorsBetween(const ColorAdjacency &adjacency, int o, int t, bool directed) {
+    if(!directed && t < o)
+        qSwap(o, t);
+    return adjacency.value(qMakePair(o, t));
+}
+
+struct IsomorphismSearch {
+    bool directed;
+    QVector<QByteArray> colors1, colors2;
+    ColorAdjacency adjacency1, adjacency2;
+    QVector<int> order, mapping;
+    QVector<bool> used;
+
+    bool extend(int depth) {
+        if(depth == order.size())
+            return true;
+        int u = order[depth], w, mw;
+        bool consistent;
+        for(int x=0; x < colors2.size(); ++x) {
+            if(used[x] || colors1[u] != colors2[x])
+                continue;
+            // The edges towards the mapped vertices, and the loops, must have the same colours
+            consistent = true;
+            for(int d=0; d <= depth && consistent; ++d) {
+                w = order[d];
+                mw = (d == depth) ? x : mapping[w];
+                consistent = (colorsBetween(adjacency1, u, w, directed) == colorsBetween(adjacency2, x, mw, directed)) &&
+                        (!directed || colorsBetween(adjacency1, w, u, directed) == colorsBetween(adjacency2, mw, x, directed));
+            }
+            if(!consistent)
+                continue;
+            mapping[u] = x;
+            used[x] = true;
+            if(extend(depth + 1))
+                return true;
+            used[x] = false;
+        }
+        return false;
+    }
+};
+
+bool Graph::isIsomorphic(const Graph *other) const {
+    int n = vertices_.size();
+    if(type_ != other->getType() || n != other->getVertexCount() || edges_.size() != other->getEdgeCount())
+        return false;
+
+    IsomorphismSearch search;
+    QVector<QByteArray> eColors1, eColors2;
+    refineColors(search.colors1, eColors1);
+    other->refineColors(search.colors2, eColors2);
+    QVector<QByteArray> sorted1 = search.colors1, sorted2 = search.colors2;
+    std::sort(sorted1.begin(), sorted1.end());
+    std::sort(sorted2.begin(), sorted2.end());
+    if(sorted1 != sorted2)
+        return false;
+    search.directed = (type_ == DIRECTED);
+    search.adjacency1 = colorAdjacency(edges_, eColors1, search.directed);
+    search.adjacency2 = colorAdjacency(other->edges_, eColors2, search.directed);
+
+    // The vertices are mapped in breadth-first order, so that each one is constrained by its mapped neighbours
+    QVector<QList<int> > neighbours(n);
+    for(auto e : edges_) {
+        neighbours[e->getOrigin()->getIndex()].append(e->getTarget()->getIndex());
+        neighbours[e->getTarget()->getIndex()].append(e->getOrigin()->getIndex());
+    }
+    QVector<bool> visited(n, false);
+    for(int s=0; s < n; ++s) {
+        if(visited[s])
+            continue;
+        visited[s] = true;
+        search.order.append(s);
+        for(int next=search.order.size()-1; next < search.order.size(); ++next) {
+            for(int v : neighbours[search.order[next]]) {
+                if(!visited[v]) {
+                    visited[v] = true;
+                    search.order.append(v);
+                }
+            }
+        }
+    }
+    search.mapping = QVector<int>(n, -1);
+    search.used = QVector<bool>(n, false);
+    return search.extend(0);
+}
+
 Graph *Graph::copy() const {
     return inducedSubgraph(vertices_.toSet());
 }
 
 Graph *Graph::neighborhoodSubgraph(int iSeed, int nbhdSize) const {
-    QSet<Vertex *> seeds;
-    seeds.insert(getVertex(iSeed));
-    return neighborhoodSubgraphRec(seeds, nbhdSize);
+    return neighborhoodView(iSeed, nbhdSize).toGraph();
 }
 
 Graph *Graph::neighborhoodSubgraph(QSet<int> iSeeds, int nbhdSize) const {
-    QSet<Vertex *> seeds;
-    for(auto i: iSeeds)
-        seeds.insert(getVertex(i));
-    return neighborhoodSubgraphRec(seeds, nbhdSize);
+    return neighborhoodView(iSeeds, nbhdSize).toGraph();
 }
 
-Graph *Graph::neighborhoodSubgraphRec(QSet<Vertex *> vertices, int nbhdSize) const {
-    if(nbhdSize <= 0)
-        return inducedSubgraph(vertices);
+Graph *Graph::randomSubgraph(int iSeed, int vCount) const {
+    return randomView(iSeed, vCount).toGraph();
+}
 
-    QList<Vertex *> temp;
-    for(auto v: vertices) {
-        for(auto e: v->getEdges(Vertex::EDGE_OUT))
-            temp.push_back(e->getTarget());
-        for(auto e: v->getEdges(Vertex::EDGE_IN))
-            temp.push_back(e->getOrigin());
+Graph *Graph::inducedSubgraph(const QSet<Vertex *> &vertices) const {
+    return inducedView(vertices).toGraph();
+}
+
+GraphView Graph::neighborhoodView(int iSeed, int nbhdSize) const {
+    QSet<int> iSeeds;
+    iSeeds.insert(iSeed);
+    return neighborhoodView(iSeeds, nbhdSize);
+}
+
+GraphView Graph::neighborhoodView(QSet<int> iSeeds, int nbhdSize) const {
+    QSet<Vertex *> vertices;
+    QList<Vertex *> frontier, next;
+    for(auto i: iSeeds) {
+        vertices.insert(getVertex(i));
+        frontier.append(getVertex(i));
     }
-    for(auto v: temp)
-        vertices.insert(v);
-    return neighborhoodSubgraphRec(vertices, nbhdSize - 1);
+
+    // Breadth-first search, only the last reached vertices are expanded at each level
+    for(int level=0; level < nbhdSize && !frontier.isEmpty(); ++level) {
+        next.clear();
+        for(auto v: frontier) {
+            for(auto e: v->getEdges(Vertex::EDGE_OUT))
+                if(!vertices.contains(e->getTarget())) {
+                    vertices.insert(e->getTarget());
+                    next.append(e->getTarget());
+                }
+            for(auto e: v->getEdges(Vertex::EDGE_IN))
+                if(!vertices.contains(e->getOrigin())) {
+                    vertices.insert(e->getOrigin());
+                    next.append(e->getOrigin());
+                }
+        }
+        frontier.swap(next);
+    }
+    return inducedView(vertices);
 }
 
-Graph *Graph::randomSubgraph(int iSeed, int vCount) const {
-    QSet<Vertex *> vertices = QSet<Vertex *>();
-    QSet<Vertex *> neighbours = QSet<Vertex *>();
+GraphView Graph::randomView(int iSeed, int vCount) const {
+    QSet<Vertex *> vertices;
+    // The neighbours are kept in a list with their positions, so that a random one is drawn and removed at once
+    QList<Vertex *> neighbours;
+    QHash<Vertex *, int> positions;
     Vertex *v = 0;
+    int k;
 
-    for(int k=0; k < vCount; ++k) {
-        if(k == 0) {
+    for(int n=0; n < vCount; ++n) {
+        if(n == 0) {
             v = getVertex(iSeed);
         } else if(!neighbours.isEmpty()) {
-            v = neighbours.toList()[Random::randInt(0, neighbours.size()-1)];
+            k = Random::randInt(0, neighbours.size()-1);
+            v = neighbours[k];
+            neighbours[k] = neighbours.last();
+            positions.insert(neighbours[k], k);
+            neighbours.removeLast();
+            positions.remove(v);
         } else {
             break;
         }
         vertices.insert(v);
+        QList<Vertex *> adjacent;
         for(auto e: v->getEdges(Vertex::EDGE_OUT))
-            neighbours.insert(e->getTarget());
+            adjacent.append(e->getTarget());
         for(auto e: v->getEdges(Vertex::EDGE_IN))
-            neighbours.insert(e->getOrigin());
-        for(auto v: vertices)
-            neighbours.remove(v);
-    }
-    return inducedSubgraph(vertices);
-}
-
-
-Graph *Graph::inducedSubgraph(const QSet<Vertex *> &vertices) const {
-    Graph *subgraph = new Graph(type_);
-    QList<Vertex *> vList = vertices.toList();
-    QList<Edge *> eList = QList<Edge *>();
-    Edge *newE = 0;
-
-    // Copy vertices
-    for(auto v: vList)
-        subgraph->addVertex(new Vertex(*v), v->getID());
-
-    // Copy edges and resets their origins and targets
-    for(auto e: edges_) {
-        if(vertices.contains(e->getOrigin()) &&  vertices.contains(e->getTarget())) {
-            subgraph->addEdge(newE = new Edge(*e));
-            newE->setOrigin(subgraph->getVertex(vList.indexOf(e->getOrigin())));
-            newE->setTarget(subgraph->getVertex(vList.indexOf(e->getTarget())));
-            eList.append(e);
-        }
-    }
-
-    // Resets the incident edges of vertices
-    for(auto v: subgraph->getVertices()) {
-        for(auto e: v->getEdges(Vertex::EDGE_IN)) {
-            v->removeEdge(e);
-            if(eList.contains(e))
-                v->addEdge(subgraph->getEdge(eList.indexOf(e)), Vertex::EDGE_IN);
-        }
-        for(auto e: v->getEdges(Vertex::EDGE_OUT)) {
-            v->removeEdge(e);
-            if(eList.contains(e))
-                v->addEdge(subgraph->getEdge(eList.indexOf(e)), Vertex::EDGE_OUT);
+            adjacent.append(e->getOrigin());
+        for(auto w: adjacent) {
+            if(!vertices.contains(w) && !positions.contains(w)) {
+                positions.insert(w, neighbours.size());
+                neighbours.append(w);
+            }
         }
     }
+    return inducedView(vertices);
+}
 
-    int pIndex = 0;
-    // Copy graph metadata
-    for(auto key : metadata_->getGraphAttributes().keys())
-        subgraph->getMetadata()->setGraphAttribute(key, metadata_->getGraphAttribute(key));
-
-    // Copy vertex metadata
-    for(int i=0; i < subgraph->getVertexCount(); ++i) {
-        pIndex = vList[i]->getIndex();
-        try {
-            for(auto key : metadata_->getAttributes(GraphElement::VERTEX, pIndex).keys())
-                subgraph->getMetadata()->setAttribute(GraphElement::VERTEX, i, key, metadata_->getAttribute(GraphElement::VERTEX, pIndex, key));
-        } catch (std::exception &e) {}
-    }
-
-    // Copy edge metadata
-    for(int ij=0; ij < subgraph->getEdgeCount(); ++ij) {
-        pIndex = eList[ij]->getIndex();
-        try {
-            for(auto key : metadata_->getAttributes(GraphElement::EDGE, pIndex).keys())
-                subgraph->getMetadata()->setAttribute(GraphElement::EDGE, ij, key, metadata_->getAttribute(GraphElement::EDGE, pIndex, key));
-        } catch (std::exception &e) {}
-    }
-
-    return subgraph;
+GraphView Graph::inducedView(const QSet<Vertex *> &vertices) const {
+    QVector<int> indexes;
+    indexes.reserve(vertices.size());
+    for(auto v: vertices)
+        indexes.append(v->getIndex());
+    return GraphView(this, indexes);
 }
 
 void Graph::load(const QString &filename) {
@@ -323,7 +644,7 @@ void Graph::load(const QString &filename) {
             fromGML(filename);
             break;
         case GXL:
-            IXmlSerializable::load(filename);
+            fromGXL(filename);
             break;
         case XML:
             fromXMLMetadata(filename);
@@ -440,102 +761,16 @@ QDomElement Graph::save(QDomDocument *document) {
 }
 
 void Graph::fromGML(const QString &filename) {
-    QString buffer = FileUtils::load(filename);
-    QRegExp directed = QRegExp("directed (0|1)");
-    QRegExp vertex_begin = QRegExp(GraphElement::toName(GraphElement::VERTEX) + " \\[");
-    QRegExp edge_begin = QRegExp(GraphElement::toName(GraphElement::EDGE) + " \\[");
-    QRegExp group_end = QRegExp("\\]");
-    QString id;
-    QString label;
-    Vertex *v = 0;
-    Edge *e = 0;
-
-    // Graph type
-    int begin = directed.indexIn(buffer), end;
-    QStringList sl = buffer.mid(begin, directed.matchedLength()).simplified().split(" ");
-    type_ = (sl[1].toInt())? DIRECTED : UNDIRECTED;
-
-    // Parse vertices
-    begin = 0;
-    begin = vertex_begin.indexIn(buffer);
-    begin += vertex_begin.matchedLength();
-    end = group_end.indexIn(buffer, begin);
-    while(begin >= 0) {
-        v = new Vertex();
-        label = "";
-        sl = buffer.mid(begin, end-begin).simplified().split(" ");
-        if(sl.size() > 1) {
-            for(auto it = sl.begin(); it != sl.end(); it += 2) {
-                if(it == sl.end()) break;
-                if(!it->compare("id", Qt::CaseInsensitive)) {
-                    id = *(it+1);
-                } else if(!it->compare("label", Qt::CaseInsensitive)) {
-                    label = (it+1)->remove('\"');
-                } else if(it->compare("comment", Qt::CaseInsensitive)) {
-                    if((it+1)->contains('\"')) {
-                        v->addAttribute(*it, QMetaType::QString, *(it+1));
-                    } else {
-                        if((it+1)->contains("."))
-                            v->addAttribute(*it, QMetaType::Double, (it+1)->toDouble());
-                        else
-                            v->addAttribute(*it, QMetaType::Int, (it+1)->toInt());
-                    }
-                }
-            }
-        }
-        if(!label.isEmpty())
-            v->setID(label);
-        addVertex(v, id);
-
-        // Prepare next iteration
-        begin = vertex_begin.indexIn(buffer, begin);
-        begin += vertex_begin.matchedLength();
-        end = group_end.indexIn(buffer, begin);
-    }
+    GMLReader reader(filename);
+    reader.read(this);
+}
 
-    // Parse edges
-    begin = 0;
-    begin = edge_begin.indexIn(buffer);
-    begin += edge_begin.matchedLength();
-    end = group_end.indexIn(buffer, begin);
-    while(begin >= 0) {
-        sl = buffer.mid(begin, end-begin).simplified().split(" ");
-        if(sl.size() > 1) {
-            e = new Edge();
-            label = "";
-            for(auto it = sl.begin(); it != sl.end(); it += 2) {
-                if(it == sl.end()) break;
-                if(it->compare("source", Qt::CaseInsensitive) == 0) {
-                    id = *(it+1);
-                    e->setOrigin(vertices_[verticesInsertionOrder_[id]]);
-                } else if(it->compare("target", Qt::CaseInsensitive) == 0) {
-                    id = *(it+1);
-                    e->setTarget(vertices_[verticesInsertionOrder_[id]]);
-                } else if(!it->compare("label", Qt::CaseInsensitive)) {
-                    label = (it+1)->remove('\"');
-                } else if(it->compare("comment", Qt::CaseInsensitive)) {
-                    if((it+1)->contains('\"')) {
-                        e->addAttribute(*it, QMetaType::QString, *(it+1));
-                    } else {
-                        if((it+1)->contains("."))
-                            e->addAttribute(*it, QMetaType::Double, (it+1)->toDouble());
-                        else
-                            e->addAttribute(*it, QMetaType::Int, (it+1)->toInt());
-                    }
-                }
-            }
-        }
-        if(!label.isEmpty())
-            e->setID(label);
-        // e may be deleted
-        addEdge(e);
-        e = edges_.last();
-        e->getOrigin()->addEdge(e, Vertex::EDGE_OUT);
-        e->getTarget()->addEdge(e, Vertex::EDGE_IN);
-        // Prepare next iteration
-        begin = edge_begin.indexIn(buffer, begin);
-        begin += edge_begin.matchedLength();
-        end = group_end.indexIn(buffer, begin);
+void Graph::fromGXL(const QString &filename) {
+    GXLReader reader(filename);
+    if(!reader.read(this)) {
+        // The file is not handled by the stream reader, falls back to the DOM
+        clear();
+        IXmlSerializable::load(filename);
     }
 }
 
@@ -582,8 +817,8 @@ void Graph::print(Printer *p) {
         p->indent();
         p->dump(QString("id %1").arg(v->getIndex()));
         p->dump(QString("label \"%1\"").arg(v->getID()));
-        for(auto key : v->getAttributes().keys()) {
-            Attribute *att = v->getAttribute(key);
+        for(auto key : v->getAttributeNames()) {
+            const Attribute *att = v->getAttribute(key);
             QString pattern = att->isTextBased()? "%1 \"%2\"" : "%1 %2";
             p->dump(pattern.arg(key, att->toString()));
         }
@@ -596,8 +831,8 @@ void Graph::print(Printer *p) {
         p->indent();
         p->dump(QString("source %1").arg(e->getOrigin()->getIndex()));
         p->dump(QString("target %1").arg(e->getTarget()->getIndex()));
-        for(auto key : e->getAttributes().keys()) {
-            Attribute *att = e->getAttribute(key);
+        for(auto key : e->getAttributeNames()) {
+            const Attribute *att = e->getAttribute(key);
             QString pattern = att->isTextBased()? "%1 \"%2\"" : "%1 %2";
             p->dump(pattern.arg(key, att->toString()));
         }
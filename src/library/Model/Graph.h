@@ -1,8 +1,11 @@
 #ifndef GEMPP_GRAPH_H
 #define GEMPP_GRAPH_H
 
+#include <QAtomicInt>
+#include <QMutex>
 #include <QSet>
 #include <QList>
+#include <QVector>
 #include <QFileInfo>
 #include "Metadata.h"
 #include "Vertex.h"
@@ -11,6 +14,8 @@
 #include "Core/Identified.h"
 #include "Core/Random.h"
 
+class GraphView;
+
 /**
  * @brief The Graph class represents an attributed graph structure, having a set of ::Vertex and a set of ::Edge.
  * The ::Graph may be directed or undirected.
@@ -100,10 +105,18 @@ class DLL_EXPORT Graph : virtual IXmlSerializable, virtual public IPrintable, vi
          * @brief Returns all the terminal ::GraphElement of the ::Graph
          * (the ones that contain no hierarchical subgraph), as well as
          * the terminal ::GraphElements contained in the hierarchical subgraphs.
-         * @param the type of terminal elements
+         * The flattened hierarchy is cached until a graph is edited.
+         * @param the type of terminal elements, or GraphElement::COUNT for both types
          * @return a list of ::GraphElement
          */
-        QList<GraphElement *> getTerminals(GraphElement::Type type) const;
+        QVector<GraphElement *> getTerminals(GraphElement::Type type) const;
+
+        /**
+         * @brief Invalidates the cached terminals of all the graphs, since the hierarchy
+         * of a graph changes with the subgraphs it contains.
+         * @see getTerminals
+         */
+        static void invalidateTerminals();
 
         /**
          * @brief Returns a vertex of the graph.
@@ -129,6 +142,7 @@ class DLL_EXPORT Graph : virtual IXmlSerializable, virtual public IPrintable, vi
         /**
          * @brief Removes a ::Vertex from the ::Graph.
          * @param id the id of the ::Vertex to remove
+         * @warning throws an Exception if the graph has no such ::Vertex
          */
         virtual void removeVertex(QString id);
 
@@ -175,6 +189,35 @@ class DLL_EXPORT Graph : virtual IXmlSerializable, virtual public IPrintable, vi
          */
         virtual void removeEdge(Edge *e);
 
+        /**
+         * @brief Starts a batch of edits. Until the batch is committed, the removed elements keep
+         * their slots, so that each removal takes a constant time: the lists of elements, their
+         * indexes and the counts do not change, except for the added elements which are appended.
+         * The removed vertices cannot be retrieved by their identifiers anymore, and the removed
+         * edges are detached from their vertices at once.
+         * @see commitEdit
+         */
+        void beginEdit();
+
+        /**
+         * @brief Ends a batch of edits, compacting and reindexing the vertices and the edges once.
+         * @see beginEdit
+         */
+        void commitEdit();
+
+        /**
+         * @brief Indicates whether a batch of edits is in progress.
+         * @return a boolean
+         */
+        bool isEditing() const;
+
+        /**
+         * @brief Indicates whether an element has been removed in the current batch of edits.
+         * @param element the ::Vertex or the ::Edge
+         * @return a boolean
+         */
+        bool isRemoved(GraphElement *element) const;
+
         /**
          * @brief Returns the ::Metadata on the ::Graph.
          * @return the ::Metadata
@@ -211,6 +254,33 @@ class DLL_EXPORT Graph : virtual IXmlSerializable, virtual public IPrintable, vi
          */
         void computeCosts(Weights *weights);
 
+        /**
+         * @brief Computes a hash of the content of the ::Graph, i.e. its type, the attributes of its
+         * elements and its edges, following the indexes of the elements. The identifiers are ignored.
+         * @return the SHA-1 hash
+         */
+        QByteArray getHash() const;
+
+        /**
+         * @brief Computes a hash of the content of the ::Graph which does not depend on the indexes of
+         * its elements, so that isomorphic graphs having the same attributes share the same hash.
+         * The vertices are coloured by their attributes, then refined with the colours of their
+         * neighbourhoods until the partition is stable (Weisfeiler-Lehman). As for any such hash,
+         * some highly regular graphs which are not isomorphic cannot be told apart.
+         * @return the SHA-1 hash
+         * @see isIsomorphic
+         */
+        QByteArray getCanonicalHash() const;
+
+        /**
+         * @brief Indicates whether another ::Graph is isomorphic to this one, with the same attributes.
+         * The vertices are mapped by backtracking, among the ones sharing their refined colour
+         * (see getCanonicalHash), and the edges between the mapped vertices are compared.
+         * @param other the other graph
+         * @return a boolean
+         */
+        bool isIsomorphic(const Graph *other) const;
+
         /**
          * @brief Returns a deep copy of this ::Graph.
          * @return the copied ::Graph
@@ -252,6 +322,39 @@ class DLL_EXPORT Graph : virtual IXmlSerializable, virtual public IPrintable, vi
          */
         Graph *inducedSubgraph(const QSet<Vertex *> &vertices) const;
 
+        /**
+         * @brief Computes a neighbourhood subgraph, as ::Graph::neighborhoodSubgraph,
+         * without copying its elements.
+         * @param iSeed the central vertex
+         * @param nbhdSize the size of the neighborhood
+         * @return the view of the subgraph
+         */
+        GraphView neighborhoodView(int iSeed, int nbhdSize) const;
+
+        /**
+         * @brief Computes a neighbourhood subgraph from several seeds, as ::Graph::neighborhoodSubgraph,
+         * without copying its elements.
+         * @param iSeeds the central vertices
+         * @param nbhdSize the size of the neighborhood
+         * @return the view of the subgraph
+         */
+        GraphView neighborhoodView(QSet<int> iSeeds, int nbhdSize) const;
+
+        /**
+         * @brief Computes a random subgraph, as ::Graph::randomSubgraph, without copying its elements.
+         * @param iSeed the central vertex
+         * @param vCount the number of vertices to select randomly
+         * @return the view of the subgraph
+         */
+        GraphView randomView(int iSeed, int vCount) const;
+
+        /**
+         * @brief Generates the subgraph induced by a set of ::Vertex, without copying its elements.
+         * @param vertices the set of ::Vertex
+         * @return the view of the subgraph
+         */
+        GraphView inducedView(const QSet<Vertex *> &vertices) const;
+
         /**
          * @brief Prints the ::Graph to a ::Printer using the GML format.
          * @param p the printer
@@ -292,6 +395,12 @@ class DLL_EXPORT Graph : virtual IXmlSerializable, virtual public IPrintable, vi
          */
         void fromGML(const QString &filename);
 
+        /**
+         * @brief Imports a graph from a GXL graph file, with a ::GXLReader if possible.
+         * @param filename the graph file
+         */
+        void fromGXL(const QString &filename);
+
         /**
          * @brief Imports a graph from a GXL graph file.
          * @see IXmlSerializable
@@ -325,13 +434,43 @@ class DLL_EXPORT Graph : virtual IXmlSerializable, virtual public IPrintable, vi
         void toXMLMetadata (const QString &filename);
 
     private:
-        Graph *neighborhoodSubgraphRec(QSet<Vertex *> vertices, int nbhdSize) const;
+        /**
+         * @brief Removes and deletes all the vertices and edges of the graph.
+         */
+        void clear();
+
+        /**
+         * @brief Colours the elements by their attributes, then refines the colours of the vertices
+         * with the ones of their neighbourhoods until the partition is stable.
+         * @param colors the colours of the vertices, following their indexes
+         * @param eColors the colours of the edges, following their indexes
+         */
+        void refineColors(QVector<QByteArray> &colors, QVector<QByteArray> &eColors) const;
 
         Type type_;
         Metadata *metadata_;
         QList<Vertex *> vertices_;
         QHash<QString, int> verticesInsertionOrder_;
+
+        /**
+         * @brief The identifier of each vertex in Graph::verticesInsertionOrder_, following their indexes.
+         */
+        QStringList vertexKeys_;
         QList<Edge *> edges_;
+
+        /**
+         * @brief Whether a batch of edits is in progress, and the elements removed in the batch.
+         */
+        bool editing_;
+        QSet<GraphElement *> removed_;
+
+        /**
+         * @brief The cached terminals of each type, and the revision of the graphs they were computed at.
+         */
+        mutable QVector<GraphElement *> terminals_[GraphElement::COUNT + 1];
+        mutable int terminalsRevision_[GraphElement::COUNT + 1];
+        mutable QMutex terminalsMutex_;
+        static QAtomicInt revision_;
 };
 
 #endif /* GEMPP_GRAPH_H */
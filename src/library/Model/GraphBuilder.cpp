@@ -0,0 +1,93 @@
+#include <algorithm>
+#include "GraphBuilder.h"
+
+GraphBuilder::GraphBuilder(Graph::Type type) : type_(type), vertexCount_(0), edgeCount_(0), origins_(0), targets_(0) {}
+
+GraphBuilder::~GraphBuilder() {}
+
+void GraphBuilder::setVertexCount(int count) {
+    if(count < 0)
+        Exception(QString("A graph can not have %1 vertices").arg(count));
+    vertexCount_ = count;
+}
+
+void GraphBuilder::setEdges(int count, const int *origins, const int *targets) {
+    if(count < 0)
+        Exception(QString("A graph can not have %1 edges").arg(count));
+    edgeCount_ = count;
+    origins_ = origins;
+    targets_ = targets;
+}
+
+void GraphBuilder::addColumn(GraphElement::Type type, const QString &name, const double *values) {
+    addColumn(type, name, QMetaType::Double, values);
+}
+
+void GraphBuilder::addColumn(GraphElement::Type type, const QString &name, const int *values) {
+    addColumn(type, name, QMetaType::Int, values);
+}
+
+void GraphBuilder::addColumn(GraphElement::Type type, const QString &name, const QString *values) {
+    addColumn(type, name, QMetaType::QString, values);
+}
+
+void GraphBuilder::addColumn(GraphElement::Type type, const QString &name, QMetaType::Type valueType, const void *values) {
+    if(type != GraphElement::VERTEX && type != GraphElement::EDGE)
+        Exception("The columns hold attributes of vertices or edges");
+    Column column = {name, valueType, values};
+    columns_[type].append(column);
+}
+
+void GraphBuilder::check() const {
+    for(int ij=0; ij < edgeCount_; ++ij)
+        if(origins_[ij] < 0 || origins_[ij] >= vertexCount_ || targets_[ij] < 0 || targets_[ij] >= vertexCount_)
+            Exception(QString("The edge %1 joins %2 and %3, but the graph has %4 vertices").arg(ij).arg(origins_[ij]).arg(targets_[ij]).arg(vertexCount_));
+}
+
+void GraphBuilder::addAttributes(GraphElement *element, int index, const QVector<Column> &columns) {
+    for(const Column &column : columns) {
+        switch(column.type) {
+            case QMetaType::Double:
+                element->addAttribute(column.name, QMetaType::Double, ((const double *) column.values)[index]);
+                break;
+            case QMetaType::Int:
+                element->addAttribute(column.name, QMetaType::Int, ((const int *) column.values)[index]);
+                break;
+            default:
+                element->addAttribute(column.name, QMetaType::QString, ((const QString *) column.values)[index]);
+                break;
+        }
+    }
+}
+
+Graph *GraphBuilder::build() const {
+    check();
+    // The columns are sorted by name once, so that each attribute is appended to its element
+    QVector<Column> columns[GraphElement::COUNT];
+    for(int t = GraphElement::VERTEX; t < GraphElement::COUNT; ++t) {
+        columns[t] = columns_[t];
+        std::sort(columns[t].begin(), columns[t].end(), [](const Column &a, const Column &b) { return a.name < b.name; });
+    }
+
+    Graph *graph = new Graph(type_);
+    Vertex *v;
+    Edge *e;
+    for(int i=0; i < vertexCount_; ++i) {
+        v = new Vertex();
+        addAttributes(v, i, columns[GraphElement::VERTEX]);
+        graph->addVertex(v);
+    }
+    for(int ij=0; ij < edgeCount_; ++ij) {
+        e = new Edge(graph->getVertex(origins_[ij]), graph->getVertex(targets_[ij]));
+        addAttributes(e, ij, columns[GraphElement::EDGE]);
+        graph->addEdge(e);
+        e->getOrigin()->addEdge(e, Vertex::EDGE_OUT);
+        e->getTarget()->addEdge(e, Vertex::EDGE_IN);
+    }
+    return graph;
+}
+
+CompactGraph *GraphBuilder::buildCompact() const {
+    check();
+    return new CompactGraph(vertexCount_, edgeCount_, origins_, targets_, type_ == Graph::DIRECTED);
+}
@@ -0,0 +1,104 @@
+#ifndef GEMPP_GRAPHBUILDER_H
+#define GEMPP_GRAPHBUILDER_H
+
+#include <QVector>
+#include "CompactGraph.h"
+#include "Graph.h"
+
+/**
+ * @brief The GraphBuilder class builds a ::Graph, or only its ::CompactGraph structure, from flat
+ * arrays generated in memory: the endpoints of the edges and one column of values for each attribute
+ * of the vertices or of the edges. It avoids writing graphs to GML or GXL files to load them again.
+ *
+ * The arrays are borrowed, not copied: they must stay valid until the graph is built. The elements
+ * are numbered from 0, as their indexes in the built graph, which may be matched at once with a ::Problem.
+ * @see Graph
+ * @see CompactGraph
+ */
+class DLL_EXPORT GraphBuilder {
+    public:
+        /**
+         * @brief Constructs a new GraphBuilder object.
+         * @param type the type of the graph to build
+         */
+        GraphBuilder(Graph::Type type = Graph::DIRECTED);
+
+        /**
+         * @brief Destructs a GraphBuilder object.
+         */
+        ~GraphBuilder();
+
+        /**
+         * @brief Sets the number of vertices.
+         * @param count the number of vertices
+         */
+        void setVertexCount(int count);
+
+        /**
+         * @brief Sets the edges from the arrays of their endpoints.
+         * @param count the number of edges
+         * @param origins the indexes of the origins of the edges
+         * @param targets the indexes of the targets of the edges
+         */
+        void setEdges(int count, const int *origins, const int *targets);
+
+        /**
+         * @brief Adds a column of numeric attributes.
+         * @param type the type of elements, GraphElement::VERTEX or GraphElement::EDGE
+         * @param name the name of the attribute
+         * @param values the value of each element
+         */
+        void addColumn(GraphElement::Type type, const QString &name, const double *values);
+
+        /**
+         * @brief Adds a column of integer attributes.
+         * @param type the type of elements, GraphElement::VERTEX or GraphElement::EDGE
+         * @param name the name of the attribute
+         * @param values the value of each element
+         */
+        void addColumn(GraphElement::Type type, const QString &name, const int *values);
+
+        /**
+         * @brief Adds a column of textual attributes.
+         * @param type the type of elements, GraphElement::VERTEX or GraphElement::EDGE
+         * @param name the name of the attribute
+         * @param values the value of each element
+         */
+        void addColumn(GraphElement::Type type, const QString &name, const QString *values);
+
+        /**
+         * @brief Builds the graph, with its attributes.
+         * @return the graph, owned by the caller
+         */
+        Graph *build() const;
+
+        /**
+         * @brief Builds the structure of the graph only, without any ::Vertex or ::Edge object.
+         * @return the compact graph, owned by the caller
+         */
+        CompactGraph *buildCompact() const;
+
+    private:
+        struct Column {
+                QString name;
+                QMetaType::Type type;
+                const void *values;
+        };
+
+        void addColumn(GraphElement::Type type, const QString &name, QMetaType::Type valueType, const void *values);
+        static void addAttributes(GraphElement *element, int index, const QVector<Column> &columns);
+
+        /**
+         * @brief Checks that the endpoints of the edges are vertices.
+         */
+        void check() const;
+
+        Graph::Type type_;
+        int vertexCount_;
+        int edgeCount_;
+        const int *origins_;
+        const int *targets_;
+        QVector<Column> columns_[GraphElement::COUNT];
+};
+
+#endif /* GEMPP_GRAPHBUILDER_H */
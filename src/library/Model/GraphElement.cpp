@@ -1,4 +1,6 @@
 #include "GraphElement.h"
+#include "Graph.h"
+#include "Core/StringPool.h"
 
 const char* GraphElement::typeName[GraphElement::COUNT] = {
     "graph",
@@ -27,15 +29,12 @@ GraphElement::GraphElement(Type type) : Identified(), Indexed() {
 GraphElement::GraphElement(const GraphElement &other) : Identified(other), Indexed(other) {
     type_ = other.getType();
     cost_ = other.getCost();
-    for(QString name : other.getAttributes().keys())
-        addAttribute(name, new Attribute(*(other.getAttribute(name))));
+    attributeIDs_ = other.attributeIDs_;
+    attributes_ = other.attributes_;
     graph_ = other.getGraph();
 }
 
-GraphElement::~GraphElement() {
-    qDeleteAll(attributes_.values());
-    attributes_.clear();
-}
+GraphElement::~GraphElement() {}
 
 double GraphElement::getCost() const {
     return cost_;
@@ -54,25 +53,66 @@ void GraphElement::setType(Type type) {
 }
 
 void GraphElement::addAttribute(const QString &name, QMetaType::Type type, QVariant value) {
-    addAttribute(name, new Attribute(type, value));
+    addAttribute(name, Attribute(type, value));
 }
 
-void GraphElement::addAttribute(const QString &name, Attribute *attribute) {
-    attributes_.insert(name, attribute);
+void GraphElement::addAttribute(const QString &name, const Attribute &attribute) {
+    Attribute copy(attribute);
+    // The equal textual values of all the elements share the same buffer
+    if(copy.getType() == QMetaType::QString)
+        copy.setValue(StringPool::get(StringPool::intern(copy.getValue().toString())));
+
+    int rank = findAttribute(name);
+    if(rank >= 0) {
+        attributes_[rank] = copy;
+        return;
+    }
+    for(rank = 0; rank < attributeIDs_.size() && StringPool::get(attributeIDs_[rank]) < name; ++rank);
+    attributeIDs_.insert(rank, StringPool::intern(name));
+    attributes_.insert(rank, copy);
 }
 
 bool GraphElement::hasAttribute(const QString &name) const {
-    return attributes_.contains(name);
+    return findAttribute(name) >= 0;
 }
 
-Attribute *GraphElement::getAttribute(const QString &name) const {
-    if(!hasAttribute(name))
+const Attribute *GraphElement::getAttribute(const QString &name) const {
+    int rank = findAttribute(name);
+    if(rank < 0)
         Exception(QString("%1 element \"%2\" has no attribute \"%3\"").arg(toName(type_), getID(), name));
-    return attributes_[name];
+    return getAttribute(rank);
+}
+
+int GraphElement::getAttributeCount() const {
+    return attributes_.size();
+}
+
+QStringList GraphElement::getAttributeNames() const {
+    QStringList names;
+    for(int id : attributeIDs_)
+        names.append(StringPool::get(id));
+    return names;
+}
+
+int GraphElement::getAttributeID(int rank) const {
+    return attributeIDs_[rank];
+}
+
+int GraphElement::getAttributeRank(int id) const {
+    for(int rank = 0; rank < attributeIDs_.size(); ++rank)
+        if(attributeIDs_[rank] == id)
+            return rank;
+    return -1;
+}
+
+const Attribute *GraphElement::getAttribute(int rank) const {
+    // Reading the shared data does not detach it
+    return attributes_.constData() + rank;
 }
 
-const QMap<QString, Attribute *> &GraphElement::getAttributes() const {
-    return attributes_;
+int GraphElement::findAttribute(const QString &name) const {
+    int id = StringPool::find(name);
+    return (id >= 0)? getAttributeRank(id) : -1;
 }
 
 void GraphElement::print(Printer *p) {
@@ -83,11 +123,11 @@ QDomElement GraphElement::save(QDomDocument *document) {
     QDomElement element = document->createElement(toName(getType()));
     QDomElement attr, attrType;
     QDomText attrText;
-    for(QString key : attributes_.keys()) {
+    for(int rank = 0; rank < attributes_.size(); ++rank) {
         attr = document->createElement("attr");
-        attr.setAttribute("name", key);
-        attrType = document->createElement(Attribute::toName(attributes_[key]->getType()));
-        attrText = document->createTextNode(attributes_[key]->getValue().toString());
+        attr.setAttribute("name", StringPool::get(attributeIDs_[rank]));
+        attrType = document->createElement(Attribute::toName(attributes_[rank].getType()));
+        attrText = document->createTextNode(attributes_[rank].getValue().toString());
         attrType.appendChild(attrText);
         attr.appendChild(attrType);
         element.appendChild(attr);
@@ -112,4 +152,5 @@ Graph *GraphElement::getGraph() const {
 
 void GraphElement::setGraph(Graph *graph) {
     graph_ = graph;
+    Graph::invalidateTerminals();
 }
@@ -1,7 +1,8 @@
 #ifndef GEMPP_GRAPHELEMENT_H
 #define GEMPP_GRAPHELEMENT_H
 
-#include <QMap>
+#include <QVector>
+#include <QStringList>
 #include "Attribute.h"
 #include "Core/IPrintable.h"
 #include "Core/Identified.h"
@@ -16,6 +17,9 @@ class Graph;
  * These elements have attributes, and it is possible to compute substitution costs between two ::GraphElement
  * of the same type as well as the creation cost of a single ::GraphElement, using the substitution and creation
  * ::Weights.
+ *
+ * The attributes are stored inline, sorted by name, and their names and textual values are interned in the
+ * ::StringPool, so that the elements of a large dataset share a single copy of each of them.
  * @see Edge
  * @see Vertex
  * @see Graph
@@ -101,11 +105,11 @@ class DLL_EXPORT GraphElement : virtual public IPrintable, virtual public IXmlEl
         void addAttribute(const QString &name, QMetaType::Type type, QVariant value);
 
         /**
-         * @brief Adds an attribute to the element.
+         * @brief Adds an attribute to the element, or replaces the attribute of the same name.
          * @param name the attribute name
          * @param attribute the attribute
          */
-        void addAttribute(const QString &name, Attribute *attribute);
+        void addAttribute(const QString &name, const Attribute &attribute);
 
         /**
          * @brief Indicates whether the element has a particular attribute.
@@ -117,16 +121,43 @@ class DLL_EXPORT GraphElement : virtual public IPrintable, virtual public IXmlEl
         /**
          * @brief Returns an attribute of the element.
          * @param name the attribute name
-         * @return the attribute
+         * @return the attribute, which is valid until another attribute is added
          * @warning throws an Exception if the attribute does not exist
          */
-        Attribute *getAttribute(const QString &name) const;
+        const Attribute *getAttribute(const QString &name) const;
+
+        /**
+         * @brief Returns the number of attributes of the element.
+         * @return the attribute count
+         */
+        int getAttributeCount() const;
 
         /**
-         * @brief Returns all attributes of the element.
-         * @return the attributes
+         * @brief Returns the names of the attributes of the element, in alphabetical order.
+         * @return the names
          */
-        const QMap<QString, Attribute *> &getAttributes() const;
+        QStringList getAttributeNames() const;
+
+        /**
+         * @brief Returns the interned name of an attribute.
+         * @param rank the rank of the attribute, in alphabetical order
+         * @return the identifier of the name in the ::StringPool
+         */
+        int getAttributeID(int rank) const;
+
+        /**
+         * @brief Returns the rank of an attribute from its interned name, without looking up the ::StringPool.
+         * @param id the identifier of the name in the ::StringPool
+         * @return the rank, or -1 if the element has no such attribute
+         */
+        int getAttributeRank(int id) const;
+
+        /**
+         * @brief Returns an attribute of the element.
+         * @param rank the rank of the attribute, in alphabetical order
+         * @return the attribute, which is valid until another attribute is added
+         */
+        const Attribute *getAttribute(int rank) const;
 
         /**
          * @brief Returns the ::Graph represented by this ::GraphElement.
@@ -171,9 +202,21 @@ class DLL_EXPORT GraphElement : virtual public IPrintable, virtual public IXmlEl
         double cost_;
 
         /**
-         * @brief The attributes of the element.
+         * @brief Returns the rank of an attribute.
+         * @param name the attribute name
+         * @return the rank, or -1 if the element has no such attribute
+         */
+        int findAttribute(const QString &name) const;
+
+        /**
+         * @brief The interned names of the attributes, sorted alphabetically.
+         */
+        QVector<int> attributeIDs_;
+
+        /**
+         * @brief The attributes of the element, in the order of GraphElement::attributeIDs_.
          */
-        QMap<QString, Attribute *> attributes_;
+        QVector<Attribute> attributes_;
 
         /**
          * @brief A subgraph represented by a ::Vertex of the parent ::Graph.
@@ -17,6 +17,10 @@ void GraphList::clean() {
             delete g;
         graphs_.clear();
     }
+    hashes_.clear();
+    errors_.clear();
+    classes_.clear();
+    representatives_.clear();
 }
 
 void GraphList::setDir(QDir directory) {
@@ -31,7 +35,23 @@ int GraphList::getGraphCount() const {
 void GraphList::addGraph(Graph *g) {
     if(graphs_.contains(g))
         Exception(QString("GraphList %1 already contains graph %2").arg(dir_.dirName(), g->getID()));
-    g->setIndex(graphs_.size());
+    addGraph(g, g->getCanonicalHash());
+}
+
+void GraphList::addGraph(Graph *g, const QByteArray &hash) {
+    int c = graphs_.size();
+    g->setIndex(c);
+    // The identical graphs are gathered as soon as they are loaded, a shared hash is confirmed exactly
+    for(int r : representatives_.value(hash)) {
+        if(graphs_[r]->isIsomorphic(g)) {
+            c = r;
+            break;
+        }
+    }
+    if(c == graphs_.size())
+        representatives_[hash].append(c);
+    hashes_.append(hash);
+    classes_.append(c);
     graphs_.append(g);
 }
 
@@ -39,6 +59,23 @@ Graph *GraphList::getGraph(int i) const {
     return graphs_[i];
 }
 
+const QByteArray &GraphList::getCanonicalHash(int i) const {
+    return hashes_[i];
+}
+
+int GraphList::getClass(int i) const {
+    return classes_[i];
+}
+
+const QStringList &GraphList::getErrors() const {
+    return errors_;
+}
+
+void GraphList::checkErrors() const {
+    if(!errors_.isEmpty())
+        Exception(QString("%1 graph file(s) of %2 could not be loaded:\n%3").arg(errors_.size()).arg(dir_.path(), errors_.join("\n")));
+}
+
 QList<Graph *>::iterator GraphList::begin() {
     return graphs_.begin();
 }
@@ -101,24 +138,69 @@ void GraphList::loadGraphs(const QString &extension) {
     // Sort the filenames in the natural order
     std::sort(sl.begin(), sl.end(), compareFileNamesNatural);
 
+    // Loading the graphs in parallel, each one at the index of its file
+    GraphLoading loading;
+    loading.filenames = sl;
+    loading.graphs = QVector<Graph *>(sl.size(), 0);
+    loading.hashes = QVector<QByteArray>(sl.size());
+    loading.errors = QVector<QString>(sl.size());
+    QSemaphore done;
+    int helpers = 0;
+    if(sl.size() > 1) {
+        GraphLoader *loader = new GraphLoader(&loading, &done);
+        while(helpers < sl.size() - 1 && loadPool()->tryStart(loader)) {
+            ++helpers;
+            loader = new GraphLoader(&loading, &done);
+        }
+        delete loader;
+    }
+    loading.work();
+    done.acquire(helpers);
+
+    // Indexing the graphs in the natural order of their files
+    for(int i=0; i < sl.size(); ++i) {
+        if(loading.graphs[i])
+            addGraph(loading.graphs[i], loading.hashes[i]);
+        else
+            errors_ << QString("%1: %2").arg(sl[i], loading.errors[i]);
+    }
+    int distinct = 0;
+    for(int i=0; i < classes_.size(); ++i)
+        if(classes_[i] == i)
+            ++distinct;
+    qcout << QString("% Loaded %1 graph(s), %2 distinct...").arg(graphs_.size()).arg(distinct) << endl;
+    if(!errors_.isEmpty())
+        qcout << QString("% %1 graph file(s) could not be loaded").arg(errors_.size()) << endl;
+}
+
+QThreadPool *GraphList::loadPool() {
+    static QThreadPool pool;
+    return &pool;
+}
+
+void GraphLoading::work() {
+    int i;
     Graph *g;
-    // Loading the graphs
-    for(auto s : sl) {
-        g = new Graph(s);
-
-        //        // Determine the class of the graph with subdirectories
-        //        QString graphClass = s;
-        //        graphClass.replace(dir_.absolutePath()+"/", "");
-        //        QStringList sl = graphClass.split("/");
-        //        sl.pop_back();
-        //        graphClass = sl.join(".");
-        //        if(!graphClass.isEmpty()) {
-        //            addGraph(graphClass, g);
-        //        } else {
-            addGraph(g);
-        //}
+    while((i = next.fetchAndAddRelaxed(1)) < filenames.size()) {
+        g = 0;
+        try {
+            g = new Graph(filenames[i]);
+            hashes[i] = g->getCanonicalHash();
+            graphs[i] = g;
+        } catch(std::exception &e) {
+            if(g) delete g;
+            errors[i] = e.what();
+        }
     }
-    qcout << QString("% Loaded %1 graph(s)...").arg(graphs_.size()) << endl;
+}
+
+GraphLoader::GraphLoader(GraphLoading *loading, QSemaphore *done) : QRunnable(), loading_(loading), done_(done) {
+    setAutoDelete(true);
+}
+
+void GraphLoader::run() {
+    loading_->work();
+    done_->release();
 }
 
 // Credit : http://www.qtcentre.org/threads/21411-QStringList-Sorting
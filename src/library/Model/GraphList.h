@@ -1,10 +1,46 @@
 #ifndef GEMPP_GRAPHLIST_H
 #define GEMPP_GRAPHLIST_H
 
+#include <QAtomicInt>
 #include <QDirIterator>
+#include <QRunnable>
+#include <QSemaphore>
+#include <QThreadPool>
 #include "Graph.h"
 #include "Core/ICleanable.h"
 
+/**
+ * @brief The GraphLoading struct holds the state shared by the threads that load the graph files
+ * of a ::GraphList. Each thread takes the next file until there are none left, and stores the graph
+ * at the index of the file, so that the order of the files is kept whatever the order of loading.
+ */
+struct GraphLoading {
+        QStringList filenames;
+        QAtomicInt next;
+        QVector<Graph *> graphs;
+        QVector<QByteArray> hashes;
+        QVector<QString> errors;
+
+        /**
+         * @brief Loads files until there are none left.
+         * The error raised by a file is kept in GraphLoading::errors, and its graph left null.
+         */
+        void work();
+};
+
+/**
+ * @brief The GraphLoader class helps loading the files of some ::GraphLoading in a thread of a pool.
+ */
+class GraphLoader : public QRunnable {
+    public:
+        GraphLoader(GraphLoading *loading, QSemaphore *done);
+        virtual void run();
+
+    private:
+        GraphLoading *loading_;
+        QSemaphore *done_;
+};
+
 class DLL_EXPORT GraphList : virtual public IPrintable, virtual public ICleanable {
     public:
         GraphList(QDir directory, QString extension = "");
@@ -14,8 +50,44 @@ class DLL_EXPORT GraphList : virtual public IPrintable, virtual public ICleanabl
         void setDir(QDir directory);
         void addGraph(Graph *g);
         Graph *getGraph(int i) const;
+
+        /**
+         * @brief Returns the canonical hash of a graph, computed when it is added.
+         * @param i the index of the graph
+         * @return the hash
+         * @see Graph::getCanonicalHash
+         */
+        const QByteArray &getCanonicalHash(int i) const;
+
+        /**
+         * @brief Returns the class of a graph, i.e. the first graph of the list which is identical to it.
+         * The graphs sharing a canonical hash are compared with Graph::isIsomorphic.
+         * @param i the index of the graph
+         * @return the index of the first identical graph
+         */
+        int getClass(int i) const;
+
+        /**
+         * @brief Loads the graph files of the directory and its subdirectories, in parallel.
+         * The graphs are indexed following the natural order of their filenames. The files which
+         * cannot be loaded are skipped, and their errors are kept for the caller to report them.
+         * @param extension the extension of the graph files, or any graph file if empty
+         * @see getErrors, checkErrors
+         */
         void loadGraphs(const QString &extension = "");
 
+        /**
+         * @brief Returns the errors raised by the files which could not be loaded.
+         * @return the errors, prefixed by the filenames
+         */
+        const QStringList &getErrors() const;
+
+        /**
+         * @brief Raises an exception listing the errors, if some files could not be loaded.
+         * @see getErrors
+         */
+        void checkErrors() const;
+
         QList<Graph *>::iterator begin();
         QList<Graph *>::iterator end();
 
@@ -23,8 +95,30 @@ class DLL_EXPORT GraphList : virtual public IPrintable, virtual public ICleanabl
         virtual void clean();
 
     private:
+        /**
+         * @brief Adds a graph whose canonical hash is already known.
+         * @param g the graph
+         * @param hash the canonical hash of the graph
+         */
+        void addGraph(Graph *g, const QByteArray &hash);
+
+        /**
+         * @brief Returns the pool of threads loading the graph files.
+         * @return the pool
+         */
+        static QThreadPool *loadPool();
+
         QDir dir_;
         QList<Graph *> graphs_;
+        QStringList errors_;
+        QList<QByteArray> hashes_;
+        QList<int> classes_;
+
+        /**
+         * @brief The first graph of each class, following their canonical hashes.
+         * Several classes share a hash when their graphs are told apart by Graph::isIsomorphic only.
+         */
+        QHash<QByteArray, QList<int> > representatives_;
 };
 
 bool compareFileNamesNatural(const QString &s1, const QString &s2);
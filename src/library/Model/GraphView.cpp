@@ -0,0 +1,115 @@
+#include <algorithm>
+#include "GraphView.h"
+
+GraphView::GraphView(const Graph *graph, QVector<int> vertices) : graph_(graph), vertices_(vertices) {
+    std::sort(vertices_.begin(), vertices_.end());
+    local_.reserve(vertices_.size());
+    for(int i=0; i < vertices_.size(); ++i)
+        local_.insert(vertices_[i], i);
+
+    // Each edge is found once, from its origin
+    for(int i : vertices_)
+        for(auto e : graph_->getVertex(i)->getEdges(Vertex::EDGE_OUT))
+            if(local_.contains(e->getTarget()->getIndex()))
+                edges_.append(e->getIndex());
+    std::sort(edges_.begin(), edges_.end());
+
+    origins_ = QVector<int>(edges_.size());
+    targets_ = QVector<int>(edges_.size());
+    for(int ij=0; ij < edges_.size(); ++ij) {
+        origins_[ij] = local_.value(getEdge(ij)->getOrigin()->getIndex());
+        targets_[ij] = local_.value(getEdge(ij)->getTarget()->getIndex());
+    }
+}
+
+GraphView::~GraphView() {}
+
+const Graph *GraphView::getGraph() const {
+    return graph_;
+}
+
+int GraphView::getVertexCount() const {
+    return vertices_.size();
+}
+
+int GraphView::getEdgeCount() const {
+    return edges_.size();
+}
+
+Vertex *GraphView::getVertex(int i) const {
+    return graph_->getVertex(vertices_[i]);
+}
+
+Edge *GraphView::getEdge(int ij) const {
+    return graph_->getEdge(edges_[ij]);
+}
+
+int GraphView::getOrigin(int ij) const {
+    return origins_[ij];
+}
+
+int GraphView::getTarget(int ij) const {
+    return targets_[ij];
+}
+
+int GraphView::indexOf(const Vertex *v) const {
+    int i = local_.value(v->getIndex(), -1);
+    return (i >= 0 && getVertex(i) == v) ? i : -1;
+}
+
+const QVector<int> &GraphView::getVertexIndexes() const {
+    return vertices_;
+}
+
+const QVector<int> &GraphView::getEdgeIndexes() const {
+    return edges_;
+}
+
+Graph *GraphView::toGraph() const {
+    Graph *subgraph = new Graph(graph_->getType());
+    QVector<Vertex *> copies(vertices_.size());
+    Vertex *v;
+    Edge *e;
+
+    // Copy vertices, without the incident edges of the parent graph
+    for(int i=0; i < vertices_.size(); ++i) {
+        copies[i] = v = new Vertex(*getVertex(i));
+        for(auto incident : v->getEdges(Vertex::EDGE_IN))
+            v->removeEdge(incident);
+        for(auto incident : v->getEdges(Vertex::EDGE_OUT))
+            v->removeEdge(incident);
+        subgraph->addVertex(v, getVertex(i)->getID());
+    }
+
+    // Copy edges and resets their origins and targets
+    for(int ij=0; ij < edges_.size(); ++ij) {
+        subgraph->addEdge(e = new Edge(*getEdge(ij)));
+        e->setOrigin(copies[origins_[ij]]);
+        e->setTarget(copies[targets_[ij]]);
+        copies[origins_[ij]]->addEdge(e, Vertex::EDGE_OUT);
+        copies[targets_[ij]]->addEdge(e, Vertex::EDGE_IN);
+    }
+
+    // Copy graph metadata
+    Metadata *metadata = graph_->getMetadata();
+    for(auto key : metadata->getGraphAttributes().keys())
+        subgraph->getMetadata()->setGraphAttribute(key, metadata->getGraphAttribute(key));
+
+    // Copy vertex metadata
+    for(int i=0; i < vertices_.size(); ++i) {
+        try {
+            for(auto key : metadata->getAttributes(GraphElement::VERTEX, vertices_[i]).keys())
+                subgraph->getMetadata()->setAttribute(GraphElement::VERTEX, i, key, metadata->getAttribute(GraphElement::VERTEX, vertices_[i], key));
+        } catch (std::exception &e) {}
+    }
+
+    // Copy edge metadata
+    for(int ij=0; ij < edges_.size(); ++ij) {
+        try {
+            for(auto key : metadata->getAttributes(GraphElement::EDGE, edges_[ij]).keys())
+                subgraph->getMetadata()->setAttribute(GraphElement::EDGE, ij, key, metadata->getAttribute(GraphElement::EDGE, edges_[ij], key));
+        } catch (std::exception &e) {}
+    }
+
+    return subgraph;
+}
@@ -0,0 +1,116 @@
+#ifndef GEMPP_GRAPHVIEW_H
+#define GEMPP_GRAPHVIEW_H
+
+#include <QHash>
+#include <QVector>
+#include "Graph.h"
+
+/**
+ * @brief The GraphView class is an induced subgraph of a ::Graph which references the vertices
+ * and the edges of its parent instead of copying them, so that many subgraphs of a large graph,
+ * e.g. neighbourhood windows, can be extracted at a low cost. The elements of the view have
+ * local indexes, following the order of their indexes in the parent graph.
+ *
+ * The view is only valid as long as its parent graph is neither destroyed nor modified.
+ * It may be turned into an independent ::Graph with GraphView::toGraph.
+ * @see Graph
+ */
+class DLL_EXPORT GraphView {
+    public:
+        /**
+         * @brief Constructs a new GraphView object, induced by some vertices of a graph.
+         * @param graph the parent graph
+         * @param vertices the indexes of the vertices in the parent graph
+         */
+        GraphView(const Graph *graph, QVector<int> vertices);
+
+        /**
+         * @brief Destructs a GraphView object.
+         */
+        ~GraphView();
+
+        /**
+         * @brief Returns the parent graph.
+         * @return the graph
+         */
+        const Graph *getGraph() const;
+
+        /**
+         * @brief Returns the number of vertices of the view.
+         * @return the count
+         */
+        int getVertexCount() const;
+
+        /**
+         * @brief Returns the number of edges of the view.
+         * @return the count
+         */
+        int getEdgeCount() const;
+
+        /**
+         * @brief Returns a vertex of the view.
+         * @param i the local index of the vertex
+         * @return the vertex of the parent graph
+         */
+        Vertex *getVertex(int i) const;
+
+        /**
+         * @brief Returns an edge of the view.
+         * @param ij the local index of the edge
+         * @return the edge of the parent graph
+         */
+        Edge *getEdge(int ij) const;
+
+        /**
+         * @brief Returns the origin of an edge.
+         * @param ij the local index of the edge
+         * @return the local index of the origin
+         */
+        int getOrigin(int ij) const;
+
+        /**
+         * @brief Returns the target of an edge.
+         * @param ij the local index of the edge
+         * @return the local index of the target
+         */
+        int getTarget(int ij) const;
+
+        /**
+         * @brief Returns the local index of a vertex of the parent graph.
+         * @param v the vertex
+         * @return the local index, or -1 if the vertex is not in the view
+         */
+        int indexOf(const Vertex *v) const;
+
+        /**
+         * @brief Returns the indexes of the vertices in the parent graph.
+         * @return the indexes, in increasing order
+         */
+        const QVector<int> &getVertexIndexes() const;
+
+        /**
+         * @brief Returns the indexes of the edges in the parent graph.
+         * @return the indexes, in increasing order
+         */
+        const QVector<int> &getEdgeIndexes() const;
+
+        /**
+         * @brief Copies the view into an independent ::Graph, with the metadata of its elements.
+         * @return the graph
+         */
+        Graph *toGraph() const;
+
+    private:
+        const Graph *graph_;
+        QVector<int> vertices_;
+        QVector<int> edges_;
+        QVector<int> origins_;
+        QVector<int> targets_;
+
+        /**
+         * @brief The local index of each vertex, from its index in the parent graph.
+         */
+        QHash<int, int> local_;
+};
+
+#endif /* GEMPP_GRAPHVIEW_H */
@@ -0,0 +1,132 @@
+#include "LabelTable.h"
+#include "AttributeTable.h"
+#include "Core/StringPool.h"
+
+LabelTable::LabelTable(Weights *weights) : weights_(weights), computed_(false) {
+    for(int t = GraphElement::VERTEX; t < GraphElement::COUNT; ++t)
+        tabulated_[t] = false;
+}
+
+LabelTable::~LabelTable() {
+    for(int t = GraphElement::VERTEX; t < GraphElement::COUNT; ++t)
+        qDeleteAll(elements_[t]);
+}
+
+int LabelTable::getLabel(GraphElement *element) {
+    // The key is made of the interned name, the type and the value of each attribute, sorted by name
+    QByteArray key;
+    const Attribute *att;
+    int name, type, text;
+    double number;
+    for(int rank = 0; rank < element->getAttributeCount(); ++rank) {
+        att = element->getAttribute(rank);
+        name = element->getAttributeID(rank);
+        type = att->getType();
+        key.append((const char *) &name, sizeof(int));
+        key.append((const char *) &type, sizeof(int));
+        if(att->isTextBased()) {
+            text = StringPool::intern(att->getValue().toString());
+            key.append((const char *) &text, sizeof(int));
+        } else {
+            number = att->getValue().toDouble();
+            key.append((const char *) &number, sizeof(double));
+        }
+    }
+
+    GraphElement::Type t = element->getType();
+    int label = keys_[t].value(key, -1);
+    if(label < 0) {
+        label = elements_[t].size();
+        keys_[t].insert(key, label);
+        GraphElement *representative = new GraphElement(*element);
+        representative->setIndex(label);
+        elements_[t].append(representative);
+    }
+    return label;
+}
+
+void LabelTable::addGraph(Graph *graph) {
+    if(computed_)
+        Exception(QString("Graph \"%1\" cannot be added to a label table whose costs have been computed").arg(graph->getID()));
+    if(contains(graph))
+        return;
+    for(Vertex *v : graph->getVertices())
+        if(v->getGraph())
+            return;
+
+    QVector<int> vLabels(graph->getVertexCount()), eLabels(graph->getEdgeCount());
+    for(Vertex *v : graph->getVertices())
+        vLabels[v->getIndex()] = getLabel(v);
+    for(Edge *e : graph->getEdges())
+        eLabels[e->getIndex()] = getLabel(e);
+    labels_[GraphElement::VERTEX].insert(graph, vLabels);
+    labels_[GraphElement::EDGE].insert(graph, eLabels);
+    graphs_.append(graph);
+}
+
+void LabelTable::computeCosts() {
+    GraphElement::Type type;
+    int n;
+    for(int t = GraphElement::VERTEX; t < GraphElement::COUNT; ++t) {
+        type = (GraphElement::Type) t;
+        n = elements_[t].size();
+
+        // Creation costs
+        creations_[t] = QVector<double>(n);
+        for(int l=0; l < n; ++l) {
+            creations_[t][l] = weights_->creationCost(elements_[t][l]);
+            elements_[t][l]->setCost(creations_[t][l]);
+        }
+
+        // Substitution costs, unless the alphabet is too large for a square table
+        tabulated_[t] = (n <= GEMPP_LABEL_LIMIT);
+        if(!tabulated_[t])
+            continue;
+        substitutions_[t] = QVector<double>(n*n);
+        AttributeSchema schema;
+        AttributeTable table(&schema, elements_[t]);
+        CostProgram program = weights_->compile(&schema, type);
+        for(int l1=0; l1 < n; ++l1) {
+            if(program.substitutionCosts(elements_[t][l1], &table, &table, creations_[t].constData(), 0, n, substitutions_[t].data() + l1*n))
+                continue;
+            for(int l2=0; l2 < n; ++l2)
+                substitutions_[t][l1*n + l2] = program.substitutionCost(elements_[t][l1], elements_[t][l2], &table, &table);
+        }
+    }
+
+    // The creation costs of the elements are set from their labels
+    double total;
+    for(Graph *graph : graphs_) {
+        total = 0;
+        const QVector<int> &vLabels = labels_[GraphElement::VERTEX][graph];
+        for(Vertex *v : graph->getVertices()) {
+            v->setCost(creations_[GraphElement::VERTEX][vLabels[v->getIndex()]]);
+            total += v->getCost();
+        }
+        const QVector<int> &eLabels = labels_[GraphElement::EDGE][graph];
+        for(Edge *e : graph->getEdges()) {
+            e->setCost(creations_[GraphElement::EDGE][eLabels[e->getIndex()]]);
+            total += e->getCost();
+        }
+        graph->setCost(total);
+    }
+    computed_ = true;
+}
+
+bool LabelTable::contains(const Graph *graph) const {
+    return labels_[GraphElement::VERTEX].contains(graph);
+}
+
+bool LabelTable::isTabulated(GraphElement::Type type) const {
+    return computed_ && tabulated_[type];
+}
+
+int LabelTable::getLabelCount(GraphElement::Type type) const {
+    return elements_[type].size();
+}
+
+const QVector<int> &LabelTable::getLabels(const Graph *graph, GraphElement::Type type) const {
+    if(!labels_[type].contains(graph))
+        Exception(QString("Graph \"%1\" has not been added to the label table").arg(graph->getID()));
+    return *labels_[type].constFind(graph);
+}
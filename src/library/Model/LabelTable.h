@@ -0,0 +1,116 @@
+#ifndef GEMPP_LABELTABLE_H
+#define GEMPP_LABELTABLE_H
+
+#include <QByteArray>
+#include <QHash>
+#include "Graph.h"
+
+/**
+ * @brief The maximum number of distinct labels of a type of element in a ::LabelTable.
+ * The substitution costs of a type are not tabulated beyond it.
+ */
+#define GEMPP_LABEL_LIMIT 2048
+
+/**
+ * @brief The LabelTable class memoizes the costs of the elements of a whole dataset.
+ *
+ * Each distinct tuple of attributes (a label) of the vertices, resp. the edges, of the added
+ * ::Graph gets an identifier, and the creation cost of each label as well as the substitution
+ * cost of each pair of labels are computed once. The creation costs of the elements are then
+ * set, and the cost matrices of a ::Problem are gathered from the table instead of being
+ * evaluated pair by pair. This pays off when the attributes take their values in a small
+ * alphabet, e.g. atom or bond types: a type of element whose number of labels exceeds
+ * GEMPP_LABEL_LIMIT is not tabulated.
+ *
+ * The hierarchical graphs are not added, and the graphs must not change once added.
+ * @see Problem
+ */
+class DLL_EXPORT LabelTable {
+    public:
+        /**
+         * @brief Constructs a new empty LabelTable object.
+         * @param weights the weights used to compute the costs
+         */
+        LabelTable(Weights *weights);
+
+        /**
+         * @brief Destructs a LabelTable object.
+         */
+        ~LabelTable();
+
+        /**
+         * @brief Assigns a label to each element of a graph.
+         * @param graph the graph, which is ignored if it is hierarchical
+         */
+        void addGraph(Graph *graph);
+
+        /**
+         * @brief Computes the costs of the labels, and sets the creation costs of the elements of the added graphs.
+         * @warning no graph can be added afterwards
+         */
+        void computeCosts();
+
+        /**
+         * @brief Indicates whether the costs of a graph are known.
+         * @param graph the graph
+         * @return a boolean
+         */
+        bool contains(const Graph *graph) const;
+
+        /**
+         * @brief Indicates whether the substitution costs of a type of element are tabulated.
+         * @param type the type of element
+         * @return a boolean
+         */
+        bool isTabulated(GraphElement::Type type) const;
+
+        /**
+         * @brief Returns the number of distinct labels.
+         * @param type the type of element
+         * @return the label count
+         */
+        int getLabelCount(GraphElement::Type type) const;
+
+        /**
+         * @brief Returns the labels of the elements of a graph.
+         * @param graph the graph
+         * @param type the type of element
+         * @return the label of each element, following their indexes
+         */
+        const QVector<int> &getLabels(const Graph *graph, GraphElement::Type type) const;
+
+        /**
+         * @brief Returns the substitution cost between two labels.
+         * @param type the type of element
+         * @param l1 the first label
+         * @param l2 the second label
+         * @return the cost
+         */
+        double getSubstitutionCost(GraphElement::Type type, int l1, int l2) const {
+            return substitutions_[type][l1*elements_[type].size() + l2];
+        }
+
+    private:
+        int getLabel(GraphElement *element);
+
+        Weights *weights_;
+        bool computed_;
+        QList<Graph *> graphs_;
+        QHash<const Graph *, QVector<int> > labels_[GraphElement::COUNT];
+
+        /**
+         * @brief The identifier of each label, which is a key made of the interned names, the types and the values of the attributes.
+         */
+        QHash<QByteArray, int> keys_[GraphElement::COUNT];
+
+        /**
+         * @brief A copy of an element of each label, whose index is the label.
+         */
+        QList<GraphElement *> elements_[GraphElement::COUNT];
+
+        bool tabulated_[GraphElement::COUNT];
+        QVector<double> creations_[GraphElement::COUNT];
+        QVector<double> substitutions_[GraphElement::COUNT];
+};
+
+#endif /* GEMPP_LABELTABLE_H */
@@ -2,10 +2,6 @@
 
 Metadata::Metadata() {
     graphAttributes_ = QMap<QString, QString>();
-    verticesAttributes_ = QMap<int, QMap<QString, QString> >();
-    edgesAttributes_ = QMap<int, QMap<QString, QString> >();
-    attributes[GraphElement::VERTEX] = &verticesAttributes_;
-    attributes[GraphElement::EDGE] = &edgesAttributes_;
 }
 
 Metadata::Metadata(const QString &filename) : Metadata() {
@@ -32,72 +28,190 @@ const QMap<QString, QString> &Metadata::getGraphAttributes() const {
     return graphAttributes_;
 }
 
+QMetaType::Type Metadata::toColumnType(const QVariant &value) {
+    switch((QMetaType::Type) value.type()) {
+        case QMetaType::Bool:
+        case QMetaType::Int:
+        case QMetaType::UInt:
+        case QMetaType::Short:
+        case QMetaType::UShort:
+            return QMetaType::Int;
+        case QMetaType::Double:
+        case QMetaType::Float:
+        case QMetaType::Long:
+        case QMetaType::ULong:
+        case QMetaType::LongLong:
+        case QMetaType::ULongLong:
+            return QMetaType::Double;
+        default:
+            return QMetaType::QString;
+    }
+}
+
+void Metadata::convert(Column &column, QMetaType::Type type) {
+    int size = column.defined.size();
+    if(type == QMetaType::Double) {
+        column.doubles = QVector<double>(size, 0);
+        for(int i=0; i < size; ++i)
+            column.doubles[i] = column.ints[i];
+        column.ints.clear();
+    } else {
+        column.strings = QVector<QString>(size);
+        for(int i=0; i < size; ++i)
+            if(column.defined[i])
+                column.strings[i] = getValue(column, i).toString();
+        column.ints.clear();
+        column.doubles.clear();
+    }
+    column.type = type;
+}
+
+QVariant Metadata::getValue(const Column &column, uint index) {
+    switch(column.type) {
+        case QMetaType::Int:
+            return QVariant(column.ints[index]);
+        case QMetaType::Double:
+            return QVariant(column.doubles[index]);
+        default:
+            return QVariant(column.strings[index]);
+    }
+}
+
+int Metadata::getColumn(GraphElement::Type type, const QString &name) const {
+    return columnIndexes_[type].value(name, -1);
+}
+
 QVariant Metadata::getAttribute(GraphElement::Type type, uint index, QString name) const {
-    if(!attributes[type]->contains(index))
+    if(index >= (uint) elements_[type].size() || !elements_[type][index])
         Exception(QString("%1 at index %2 does not have metadata").arg(GraphElement::toName(type)).arg(index));
-    if(!attributes[type]->value(index).contains(name))
+    int column = getColumn(type, name);
+    if(column < 0 || index >= (uint) columns_[type][column].defined.size() || !columns_[type][column].defined[index])
         Exception(QString("Metadata of %1 at index %2 does not contain %3 attribute").arg(GraphElement::toName(type)).arg(index).arg(name));
-    return QVariant(attributes[type]->value(index).value(name));
+    return getValue(columns_[type][column], index);
 }
 
 void Metadata::setAttribute(GraphElement::Type type, uint index, QString name, QVariant value) {
-    if(!attributes[type]->contains(index))
-        attributes[type]->insert(index, QMap<QString, QString>());
-    QMap<QString, QString> map = attributes[type]->value(index);
-    map.insert(name, value.toString());
-    attributes[type]->insert(index, map);
+    if(index >= (uint) elements_[type].size())
+        elements_[type].resize(index + 1);
+    elements_[type][index] = true;
+
+    int column = getColumn(type, name);
+    QMetaType::Type valueType = toColumnType(value);
+    if(column < 0) {
+        column = columns_[type].size();
+        Column c;
+        c.name = name;
+        c.type = valueType;
+        columns_[type].append(c);
+        columnIndexes_[type].insert(name, column);
+    }
+    Column &c = columns_[type][column];
+    // The integers fit in a column of numbers, and anything fits in a column of text
+    if(c.type != valueType && c.type != QMetaType::QString && valueType != QMetaType::Int)
+        convert(c, valueType);
+
+    if(index >= (uint) c.defined.size()) {
+        c.defined.resize(index + 1);
+        switch(c.type) {
+            case QMetaType::Int:
+                c.ints.resize(index + 1);
+                break;
+            case QMetaType::Double:
+                c.doubles.resize(index + 1);
+                break;
+            default:
+                c.strings.resize(index + 1);
+                break;
+        }
+    }
+    c.defined[index] = true;
+    switch(c.type) {
+        case QMetaType::Int:
+            c.ints[index] = value.toInt();
+            break;
+        case QMetaType::Double:
+            c.doubles[index] = value.toDouble();
+            break;
+        default:
+            c.strings[index] = value.toString();
+            break;
+    }
 }
 
 const QMap<QString, QString> Metadata::getAttributes(GraphElement::Type type, uint index) const {
-    if(!attributes[type]->contains(index))
+    if(index >= (uint) elements_[type].size() || !elements_[type][index])
         Exception(QString("%1 at index %2 does not have metadata").arg(GraphElement::toName(type)).arg(index));
-    return attributes[type]->value(index);
+    QMap<QString, QString> attributes;
+    for(const Column &c : columns_[type])
+        if(index < (uint) c.defined.size() && c.defined[index])
+            attributes.insert(c.name, getValue(c, index).toString());
+    return attributes;
+}
+
+void Metadata::clear(GraphElement::Type type) {
+    columns_[type].clear();
+    columnIndexes_[type].clear();
+    elements_[type].clear();
 }
 
 void Metadata::fromXML() {
-    verticesAttributes_.clear();
-    edgesAttributes_.clear();
+    clear(GraphElement::VERTEX);
+    clear(GraphElement::EDGE);
 
-    QDomElement graph, vertex, edge;
+    QDomElement graph, element;
+    QString value;
+    bool isInt, isDouble;
+    int intValue;
+    double doubleValue;
     graph = document()->documentElement();
     for(int i=0; i < graph.attributes().length(); ++i)
         graphAttributes_.insert(graph.attributes().item(i).nodeName(), graph.attributes().item(i).nodeValue());
-    vertex = graph.firstChildElement("Node");
-    uint index = 0;
-    while(!vertex.isNull()) {
-        verticesAttributes_.insert(index, QMap<QString,QString>());
-        for(int i=0; i < vertex.attributes().length(); ++i)
-            verticesAttributes_[index].insert(vertex.attributes().item(i).nodeName(), vertex.attributes().item(i).nodeValue());
-        vertex = vertex.nextSiblingElement("Node");
-        ++index;
-    }
-    edge = graph.firstChildElement("Edge");
-    index = 0;
-    while(!edge.isNull()) {
-        edgesAttributes_.insert(index, QMap<QString,QString>());
-        for(int i=0; i < edge.attributes().length(); ++i)
-            edgesAttributes_[index].insert(edge.attributes().item(i).nodeName(), edge.attributes().item(i).nodeValue());
-        edge = edge.nextSiblingElement("Edge");
-        ++index;
+
+    // The text is parsed once, the numbers are stored as such
+    const char *tags[GraphElement::COUNT] = {0, "Node", "Edge"};
+    for(int t = GraphElement::VERTEX; t < GraphElement::COUNT; ++t) {
+        GraphElement::Type type = (GraphElement::Type) t;
+        element = graph.firstChildElement(tags[t]);
+        uint index = 0;
+        while(!element.isNull()) {
+            if(index >= (uint) elements_[type].size())
+                elements_[type].resize(index + 1);
+            elements_[type][index] = true;
+            for(int i=0; i < element.attributes().length(); ++i) {
+                value = element.attributes().item(i).nodeValue();
+                intValue = value.toInt(&isInt);
+                doubleValue = value.toDouble(&isDouble);
+                if(isInt && QString::number(intValue) == value)
+                    setAttribute(type, index, element.attributes().item(i).nodeName(), intValue);
+                else if(isDouble && QVariant(doubleValue).toString() == value)
+                    setAttribute(type, index, element.attributes().item(i).nodeName(), doubleValue);
+                else
+                    setAttribute(type, index, element.attributes().item(i).nodeName(), value);
+            }
+            element = element.nextSiblingElement(tags[t]);
+            ++index;
+        }
     }
 }
 
 void Metadata::toXML() {
-    QDomElement graph, vertex, edge;
+    QDomElement graph, element;
     graph = document()->createElement("Graph");
     for(auto key : graphAttributes_.keys())
         graph.setAttribute(key, graphAttributes_[key]);
-    for(auto index : verticesAttributes_.keys()) {
-        vertex = document()->createElement("Node");
-        for(auto key : verticesAttributes_[index].keys())
-            vertex.setAttribute(key, verticesAttributes_[index][key]);
-        graph.appendChild(vertex);
-    }
-    for(auto index : edgesAttributes_.keys()) {
-        edge = document()->createElement("Edge");
-        for(auto key : edgesAttributes_[index].keys())
-            edge.setAttribute(key, edgesAttributes_[index][key]);
-        graph.appendChild(edge);
+
+    const char *tags[GraphElement::COUNT] = {0, "Node", "Edge"};
+    for(int t = GraphElement::VERTEX; t < GraphElement::COUNT; ++t) {
+        GraphElement::Type type = (GraphElement::Type) t;
+        for(int index=0; index < elements_[type].size(); ++index) {
+            if(!elements_[type][index])
+                continue;
+            element = document()->createElement(tags[t]);
+            QMap<QString, QString> attributes = getAttributes(type, index);
+            for(auto key : attributes.keys())
+                element.setAttribute(key, attributes[key]);
+            graph.appendChild(element);
+        }
     }
     document()->appendChild(graph);
 }
@@ -4,9 +4,16 @@
 #include <QtXml/QtXml>
 #include <QMap>
 #include <QList>
+#include <QVector>
 #include "GraphElement.h"
 #include "Core/IXmlSerializable.h"
 
+/**
+ * @brief The Metadata class holds the information about a graph and its elements which is not used
+ * to match them, e.g. the positions of the vertices. The attributes of the elements are stored in
+ * typed columns, one for each attribute name and type of element, so that reading them back is an
+ * array read. The values are converted to text only to be saved as XML.
+ */
 class DLL_EXPORT Metadata : virtual public IXmlSerializable {
         friend class Graph;
     public:
@@ -22,15 +29,73 @@ class DLL_EXPORT Metadata : virtual public IXmlSerializable {
         void setAttribute(GraphElement::Type type, uint index, QString name, QVariant value);
         const QMap<QString, QString> getAttributes(GraphElement::Type type, uint index) const;
 
+        /**
+         * @brief Returns the column of an attribute of the elements.
+         * @param type the type of elements
+         * @param name the name of the attribute
+         * @return the index of the column, or -1 if no element has this attribute
+         */
+        int getColumn(GraphElement::Type type, const QString &name) const;
+
+        /**
+         * @brief Reads a numeric attribute from its column, without any lookup by name.
+         * Throws an Exception, as Metadata::getAttribute does, if the column does not exist, if the element
+         * does not have this attribute or if the attribute is textual.
+         * @param type the type of the element
+         * @param column the index of the column, from Metadata::getColumn
+         * @param index the index of the element
+         * @return the value
+         */
+        inline double getNumber(GraphElement::Type type, int column, uint index) const {
+            if(column < 0 || column >= columns_[type].size())
+                Exception(QString("Metadata of %1 has no column %2").arg(GraphElement::toName(type)).arg(column));
+            const Column &c = columns_[type][column];
+            if(index >= (uint) c.defined.size() || !c.defined[index])
+                Exception(QString("Metadata of %1 at index %2 does not contain %3 attribute").arg(GraphElement::toName(type)).arg(index).arg(c.name));
+            switch(c.type) {
+                case QMetaType::Double:
+                    return c.doubles[index];
+                case QMetaType::Int:
+                    return c.ints[index];
+                default:
+                    break;
+            }
+            Exception(QString("Attribute %1 of %2 at index %3 is not a number").arg(c.name, GraphElement::toName(type)).arg(index));
+            return 0;
+        }
+
     protected:
         virtual void fromXML();
         virtual void toXML();
 
     private:
+        /**
+         * @brief The Column struct holds the values of an attribute for all the elements of a type,
+         * in an array matching its type: integer, floating point number or text.
+         */
+        struct Column {
+                QString name;
+                QMetaType::Type type;
+                QVector<int> ints;
+                QVector<double> doubles;
+                QVector<QString> strings;
+                QVector<bool> defined;
+        };
+
+        static QMetaType::Type toColumnType(const QVariant &value);
+        static void convert(Column &column, QMetaType::Type type);
+        static QVariant getValue(const Column &column, uint index);
+
+        void clear(GraphElement::Type type);
+
         QMap<QString, QString> graphAttributes_;
-        QMap<int, QMap<QString, QString> > verticesAttributes_;
-        QMap<int, QMap<QString, QString> > edgesAttributes_;
-        QMap<int, QMap<QString, QString> > *attributes[GraphElement::COUNT];
+        QVector<Column> columns_[GraphElement::COUNT];
+        QHash<QString, int> columnIndexes_[GraphElement::COUNT];
+
+        /**
+         * @brief Whether each element has metadata, even without any attribute.
+         */
+        QVector<bool> elements_[GraphElement::COUNT];
 };
 
 #endif /* GEMPP_METADATA_H */
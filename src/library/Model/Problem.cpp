@@ -1,4 +1,6 @@
 #include "Problem.h"
+#include "SubproblemMemo.h"
+#include "Core/StringPool.h"
 
 const char *Problem::typeName[Problem::COUNT] = {
     "none",
@@ -18,14 +20,24 @@ QString Problem::toName(Type type) {
     return typeName[type];
 }
 
-Problem::Problem(Type type, Graph *query, Graph *target, Problem *parent) : type_(type), query_(query), target_(target), parent_(parent), mutex_(QMutex::Recursive) {
+Problem::Problem(Type type, Graph *query, Graph *target, Problem *parent) : type_(type), query_(query), target_(target), parent_(parent), token_(0), labels_(0), costs_(0), cache_(0), eSchema_(0), qeTable_(0), teTable_(0), eProgram_(0), qeLabels_(0), teLabels_(0), memo_(0), waiting_(0), mutex_(QMutex::Recursive) {
     if(query_->getType() != target_->getType())
         Exception("Both graphs must have the same type (directed or undirected).");
     vCosts_ = Matrix<double>(query_->getVertexCount(), target_->getVertexCount());
-    eCosts_ = Matrix<double>(query_->getEdgeCount(), target_->getEdgeCount());
+    compactQuery_ = new CompactGraph(query_);
+    compactTarget_ = new CompactGraph(target_);
+    if(parent_) {
+        token_ = parent_->getCancellationToken();
+        memo_ = parent_->getSubproblemMemo();
+    }
 }
 
 Problem::~Problem() {
+    delete compactQuery_;
+    delete compactTarget_;
+    clearEdgeCosts();
+    if(costs_)
+        delete costs_;
     //qDeleteAll(subproblems_);
 }
 
@@ -41,16 +53,77 @@ Graph *Problem::getTarget() const {
     return target_;
 }
 
+const CompactGraph *Problem::getCompactQuery() const {
+    return compactQuery_;
+}
+
+const CompactGraph *Problem::getCompactTarget() const {
+    return compactTarget_;
+}
+
 Problem *Problem::getParent() const {
     return parent_;
 }
 
+void Problem::setCancellationToken(CancellationToken *token) {
+    token_ = token;
+}
+
+CancellationToken *Problem::getCancellationToken() const {
+    return token_;
+}
+
+void Problem::setLabelTable(const LabelTable *labels) {
+    labels_ = labels;
+}
+
+const LabelTable *Problem::getLabelTable() const {
+    return labels_;
+}
+
+void Problem::setCostMatrices(CostMatrices *costs) {
+    if(costs_ && costs_ != costs)
+        delete costs_;
+    costs_ = costs;
+}
+
+const CostMatrices *Problem::getCostMatrices() const {
+    return costs_;
+}
+
+void Problem::setCostCache(CostCache *cache) {
+    cache_ = cache;
+}
+
+CostCache *Problem::getCostCache() const {
+    return cache_;
+}
+
+void Problem::setSubproblemMemo(SubproblemMemo *memo) {
+    memo_ = memo;
+}
+
+SubproblemMemo *Problem::getSubproblemMemo() const {
+    return memo_;
+}
+
+bool Problem::isCancelled() const {
+    return (token_ && token_->isCancelled());
+}
+
 double Problem::getCost(GraphElement::Type type, int queryIndex, int targetIndex) const {
     switch(type) {
         case GraphElement::VERTEX:
             return vCosts_.getElement(queryIndex, targetIndex);
         case GraphElement::EDGE:
-            return eCosts_.getElement(queryIndex, targetIndex);
+            // The flat edges are evaluated again on each request, only the computed or added costs are stored
+            if(eStored_.loadAcquire()) {
+                QMutexLocker locker(&eMutex_);
+                auto it = eCosts_.constFind(getEdgeKey(queryIndex, targetIndex));
+                if(it != eCosts_.constEnd())
+                    return it.value();
+            }
+            return getEdgeCost(queryIndex, targetIndex);
         default:
             break;
     }
@@ -66,9 +139,15 @@ void Problem::addCost(GraphElement::Type type, int queryIndex, int targetIndex,
         case GraphElement::VERTEX:
             vCosts_.addElement(queryIndex, targetIndex, value);
             break;
-        case GraphElement::EDGE:
-            eCosts_.addElement(queryIndex, targetIndex, value);
+        case GraphElement::EDGE: {
+            QMutexLocker locker(&eMutex_);
+            qint64 key = getEdgeKey(queryIndex, targetIndex);
+            if(!eCosts_.contains(key))
+                eCosts_.insert(key, getEdgeCost(queryIndex, targetIndex));
+            eCosts_[key] += value;
+            eStored_.storeRelease(1);
             break;
+        }
         default:
             break;
     }
@@ -79,59 +158,66 @@ void Problem::addCost(CostIndex costIndex, double value) {
 }
 
 void Problem::computeCosts(Weights *weights) {
-    // Creation costs
-    query_->computeCosts(weights);
-    target_->computeCosts(weights);
+    // The precomputed or cached costs replace the computation
+    if(!costs_ && cache_)
+        costs_ = cache_->find(query_, target_);
+    if(costs_) {
+        clearEdgeCosts();
+        loadCosts();
+        mutex_.lock();
+        emit ready(const_cast<Problem *>(this));
+        mutex_.unlock();
+        return;
+    }
 
-    // Substitution costs
-    double cost;
+    // The creation costs of the labelled graphs are already known
+    bool labelled = labels_ && labels_->contains(query_) && labels_->contains(target_);
+    if(!labelled) {
+        query_->computeCosts(weights);
+        target_->computeCosts(weights);
+    }
 
-    // Prevent from emitting ready signal too early
-    mutex_.lock();
+    bool vLabelled = labelled && labels_->isTabulated(GraphElement::VERTEX);
+    bool eLabelled = labelled && labels_->isTabulated(GraphElement::EDGE);
 
-    // Vertices
-    Vertex *qv, *tv;
-    for(int i=0; i < query_->getVertexCount(); ++i) {
-        for(int k=0; k < target_->getVertexCount(); ++k) {
-            qv = query_->getVertex(i);
-            tv = target_->getVertex(k);
-            if(qv->getGraph() && tv->getGraph()) {
-                computeGraphCost(qv->getGraph(), tv->getGraph(), weights, GraphElement::VERTEX, i, k);
-                continue;
-            }
+    // The attributes are read from tables, and the weights of their columns are compiled once for all the threads
+    AttributeSchema vSchema;
+    AttributeTable qvTable(&vSchema, vLabelled ? QList<Vertex *>() : query_->getVertices());
+    AttributeTable tvTable(&vSchema, vLabelled ? QList<Vertex *>() : target_->getVertices());
+    CostProgram vProgram = weights->compile(&vSchema, GraphElement::VERTEX);
 
-            if(qv->getGraph())
-                cost = computeCost(tv, qv->getGraph(), weights);
-            else if (tv->getGraph())
-                cost = computeCost(qv, tv->getGraph(), weights);
-            else
-                cost = weights->substitutionCost(qv, tv);
-            vCosts_.setElement(i, k, cost);
-        }
+    // The edge costs are evaluated on demand, only the means to do so are kept
+    clearEdgeCosts();
+    if(eLabelled) {
+        qeLabels_ = &labels_->getLabels(query_, GraphElement::EDGE);
+        teLabels_ = &labels_->getLabels(target_, GraphElement::EDGE);
+    } else {
+        eSchema_ = new AttributeSchema();
+        qeTable_ = new AttributeTable(eSchema_, query_->getEdges());
+        teTable_ = new AttributeTable(eSchema_, target_->getEdges());
+        eProgram_ = new CostProgram(weights->compile(eSchema_, GraphElement::EDGE));
+        // Missing attributes are reported now rather than by the thread solving the problem
+        int column, row = eProgram_->findMissingValue(qeTable_, teTable_, &column);
+        if(row >= 0)
+            Exception(QString("%1 element \"%2\" has no attribute \"%3\"").arg(GraphElement::toName(GraphElement::EDGE), target_->getEdge(row)->getID(), StringPool::get(eSchema_->getName(column))));
     }
 
-    // Edges
-    Edge *qe, *te;
-    for(int ij=0; ij < query_->getEdgeCount(); ++ij) {
-        for(int kl=0; kl < target_->getEdgeCount(); ++kl) {
-            qe = query_->getEdge(ij);
-            te = target_->getEdge(kl);
-            if(qe->getGraph() && te->getGraph()) {
-                computeGraphCost(qe->getGraph(), te->getGraph(), weights, GraphElement::EDGE, ij, kl);
-                continue;
-            }
+    // Prevent from emitting ready signal too early
+    mutex_.lock();
 
-            if(qe->getGraph())
-                cost = computeCost(te, qe->getGraph(), weights);
-            else if (te->getGraph())
-                cost = computeCost(qe, te->getGraph(), weights);
-            else
-                cost = weights->substitutionCost(qe, te);
-            eCosts_.setElement(ij, kl, cost);
-        }
-    }
+    // Vertex substitution costs, read from the label table when possible
+    if(vLabelled)
+        computeVertexCosts();
+    else
+        computeVertexCosts(weights, &vProgram, &qvTable, &tvTable);
 
-    if(subproblems_.isEmpty())
+    // Edge substitution costs, only the hierarchical ones are computed now
+    computeEdgeCosts(weights);
+
+    if(cache_ && subproblems_.isEmpty() && !waiting_ && !isCancelled())
+        cache_->insert(this);
+
+    if(subproblems_.isEmpty() && !waiting_)
         emit ready(const_cast<Problem *>(this));
 
     mutex_.unlock();
@@ -150,30 +236,328 @@ void Problem::save(const QString &filename) {
     FileUtils::save(this, filename);
 }
 
+void Problem::computeEdgeCosts(Weights *weights) {
+    int nQ = query_->getEdgeCount(), nT = target_->getEdgeCount();
+    QVector<int> tHierarchical;
+    bool hierarchical = false;
+    for(int kl=0; kl < nT; ++kl)
+        if(target_->getEdge(kl)->getGraph())
+            tHierarchical.append(kl);
+    for(int ij=0; ij < nQ && !hierarchical; ++ij)
+        hierarchical = query_->getEdge(ij)->getGraph();
+    if(!hierarchical && tHierarchical.isEmpty())
+        return;
+    eStored_.storeRelease(1);
+
+    // The row of a hierarchical query edge is computed entirely, the other rows only at the hierarchical target edges
+    Edge *q, *t;
+    int count, kl;
+    for(int ij=0; ij < nQ; ++ij) {
+        // Stop filling the costs, the problem will not be solved anyway
+        if(isCancelled())
+            break;
+        q = query_->getEdge(ij);
+        count = q->getGraph() ? nT : tHierarchical.size();
+        for(int c=0; c < count; ++c) {
+            kl = q->getGraph() ? c : tHierarchical[c];
+            t = target_->getEdge(kl);
+            if(q->getGraph() && t->getGraph()) {
+                // The value of the subproblem is added once solved
+                eMutex_.lock();
+                eCosts_.insert(getEdgeKey(ij, kl), 0);
+                eMutex_.unlock();
+                computeGraphCost(q->getGraph(), t->getGraph(), weights, GraphElement::EDGE, ij, kl);
+            } else {
+                double cost = q->getGraph() ? computeCost(t, q->getGraph(), weights) : computeCost(q, t->getGraph(), weights);
+                eMutex_.lock();
+                eCosts_.insert(getEdgeKey(ij, kl), cost);
+                eMutex_.unlock();
+            }
+        }
+    }
+}
+
+double Problem::getEdgeCost(int queryIndex, int targetIndex) const {
+    if(costs_)
+        return costs_->getSubstitutionCost(GraphElement::EDGE, queryIndex, targetIndex);
+    if(qeLabels_)
+        return labels_->getSubstitutionCost(GraphElement::EDGE, qeLabels_->at(queryIndex), teLabels_->at(targetIndex));
+    if(eProgram_)
+        return eProgram_->substitutionCost(query_->getEdge(queryIndex), target_->getEdge(targetIndex), qeTable_, teTable_);
+    return 0;
+}
+
+void Problem::clearEdgeCosts() {
+    if(eProgram_)
+        delete eProgram_;
+    if(qeTable_)
+        delete qeTable_;
+    if(teTable_)
+        delete teTable_;
+    if(eSchema_)
+        delete eSchema_;
+    eProgram_ = 0;
+    qeTable_ = teTable_ = 0;
+    eSchema_ = 0;
+    qeLabels_ = teLabels_ = 0;
+    QMutexLocker locker(&eMutex_);
+    eCosts_.clear();
+    eStored_.storeRelease(0);
+}
+
+qint64 Problem::getEdgeKey(int queryIndex, int targetIndex) const {
+    return (qint64) queryIndex * target_->getEdgeCount() + targetIndex;
+}
+
+void Problem::loadCosts() {
+    GraphElement::Type types[2] = {GraphElement::VERTEX, GraphElement::EDGE};
+    int nQ, nT;
+    for(GraphElement::Type type : types) {
+        nQ = (type == GraphElement::VERTEX) ? query_->getVertexCount() : query_->getEdgeCount();
+        nT = (type == GraphElement::VERTEX) ? target_->getVertexCount() : target_->getEdgeCount();
+        if(costs_->getQueryCount(type) != nQ || costs_->getTargetCount(type) != nT)
+            Exception(QString("The cost matrices of %1 and %2 hold %3x%4 %5 costs instead of %6x%7").arg(query_->getID(), target_->getID()).arg(costs_->getQueryCount(type)).arg(costs_->getTargetCount(type)).arg(GraphElement::toName(type).toLower()).arg(nQ).arg(nT));
+    }
+
+    // Creation costs
+    double total = 0;
+    for(Vertex *v : query_->getVertices()) {
+        v->setCost(costs_->getQueryCost(GraphElement::VERTEX, v->getIndex()));
+        total += v->getCost();
+    }
+    for(Edge *e : query_->getEdges()) {
+        e->setCost(costs_->getQueryCost(GraphElement::EDGE, e->getIndex()));
+        total += e->getCost();
+    }
+    query_->setCost(total);
+    total = 0;
+    for(Vertex *v : target_->getVertices()) {
+        v->setCost(costs_->getTargetCost(GraphElement::VERTEX, v->getIndex()));
+        total += v->getCost();
+    }
+    for(Edge *e : target_->getEdges()) {
+        e->setCost(costs_->getTargetCost(GraphElement::EDGE, e->getIndex()));
+        total += e->getCost();
+    }
+    target_->setCost(total);
+
+    // Vertex substitution costs, the edge ones are read on demand
+    for(int i=0; i < query_->getVertexCount(); ++i)
+        for(int k=0; k < target_->getVertexCount(); ++k)
+            vCosts_.setElement(i, k, costs_->getSubstitutionCost(GraphElement::VERTEX, i, k));
+}
+
+void Problem::computeVertexCosts(Weights *weights, const CostProgram *program, const AttributeTable *qTable, const AttributeTable *tTable) {
+    GraphElement::Type type = GraphElement::VERTEX;
+    CostTiles tiles;
+    tiles.problem = this;
+    tiles.program = program;
+    tiles.qTable = qTable;
+    tiles.tTable = tTable;
+    int nQ = query_->getVertexCount();
+    int nT = target_->getVertexCount();
+    tiles.qElements = QVector<GraphElement *>(nQ);
+    for(int i=0; i < nQ; ++i)
+        tiles.qElements[i] = query_->getVertex(i);
+
+    // The target elements and their creation costs, read by the cost kernel
+    tiles.tElements = QVector<GraphElement *>(nT);
+    tiles.tCosts = QVector<double>(nT);
+    tiles.hierarchical = false;
+    for(int k=0; k < nT; ++k) {
+        tiles.tElements[k] = target_->getVertex(k);
+        tiles.tCosts[k] = tiles.tElements[k]->getCost();
+        tiles.hierarchical = tiles.hierarchical || tiles.tElements[k]->getGraph();
+    }
+    if(nQ == 0 || nT == 0)
+        return;
+
+    // Each tile is a range of columns of a row
+    tiles.width = qMin(nT, GEMPP_COST_TILE);
+    tiles.tileCount = nQ * ((nT + tiles.width - 1) / tiles.width);
+    tiles.costs = QVector<double>(nQ * nT);
+    tiles.next.store(0);
+
+    // The idle threads of the shared pool help the current one, the others are not waited for
+    QSemaphore done;
+    int helpers = 0;
+    if(tiles.tileCount > 1) {
+        CostWorker *worker = new CostWorker(&tiles, &done);
+        while(helpers < tiles.tileCount - 1 && costPool()->tryStart(worker)) {
+            ++helpers;
+            worker = new CostWorker(&tiles, &done);
+        }
+        delete worker;
+    }
+    tiles.work();
+    done.acquire(helpers);
+    if(!tiles.error.isEmpty())
+        Exception(tiles.error);
+
+    // The hierarchical elements are handled afterwards, in the original order, from the current thread
+    Matrix<double> &costs = vCosts_;
+    GraphElement *q, *t;
+    for(int i=0; i < nQ; ++i) {
+        // Stop filling the costs, the problem will not be solved anyway
+        if(isCancelled())
+            break;
+        q = tiles.qElements[i];
+        for(int k=0; k < nT; ++k) {
+            t = tiles.tElements[k];
+            if(q->getGraph() && t->getGraph())
+                computeGraphCost(q->getGraph(), t->getGraph(), weights, type, i, k);
+            else if(q->getGraph())
+                costs.setElement(i, k, computeCost(t, q->getGraph(), weights));
+            else if (t->getGraph())
+                costs.setElement(i, k, computeCost(q, t->getGraph(), weights));
+            else
+                costs.setElement(i, k, tiles.costs[i*nT + k]);
+        }
+    }
+}
+
+void Problem::computeVertexCosts() {
+    GraphElement::Type type = GraphElement::VERTEX;
+    const QVector<int> &q = labels_->getLabels(query_, type);
+    const QVector<int> &t = labels_->getLabels(target_, type);
+    for(int i=0; i < q.size(); ++i) {
+        // Stop filling the costs, the problem will not be solved anyway
+        if(isCancelled())
+            break;
+        for(int k=0; k < t.size(); ++k)
+            vCosts_.setElement(i, k, labels_->getSubstitutionCost(type, q[i], t[k]));
+    }
+}
+
+QThreadPool *Problem::costPool() {
+    static QThreadPool pool;
+    return &pool;
+}
+
+void CostTiles::work() {
+    int tile;
+    while((tile = next.fetchAndAddRelaxed(1)) < tileCount) {
+        if(problem->isCancelled())
+            return;
+        try {
+            compute(tile);
+        } catch(std::exception &e) {
+            QMutexLocker locker(&mutex);
+            if(error.isEmpty())
+                error = e.what();
+            next.store(tileCount);
+        }
+    }
+}
+
+void CostTiles::compute(int tile) {
+    int nT = tElements.size(), blocks = (nT + width - 1) / width;
+    int i = tile / blocks, begin = (tile % blocks) * width, end = qMin(begin + width, nT);
+    GraphElement *q = qElements[i];
+    double *result = costs.data() + i*nT;
+    if(q->getGraph())
+        return;
+    if(!hierarchical && program->substitutionCosts(q, qTable, tTable, tCosts.constData(), begin, end, result + begin))
+        return;
+    for(int k=begin; k < end; ++k)
+        if(!tElements[k]->getGraph())
+            result[k] = program->substitutionCost(q, tElements[k], qTable, tTable);
+}
+
+CostWorker::CostWorker(CostTiles *tiles, QSemaphore *done) : QRunnable(), tiles_(tiles), done_(done) {
+    setAutoDelete(true);
+}
+
+void CostWorker::run() {
+    tiles_->work();
+    done_->release();
+}
+
 double Problem::computeCost(GraphElement *element, Graph *graph, Weights *weights) {
-    QList<double> costs;
-    QList<GraphElement *> terminals = graph->getTerminals(element->getType());
-    for(GraphElement *other : terminals)
-        costs.append(weights->substitutionCost(element, other));
-    int iMin = std::min_element(costs.begin(), costs.end()) - costs.begin();
-    return costs[iMin] + graph->getCost() - terminals[iMin]->getCost();
+    // The terminals are flattened once per graph, the cheapest substitution is searched in place
+    QVector<GraphElement *> terminals = graph->getTerminals(element->getType());
+    GraphElement *const *others = terminals.constData();
+    int iMin = 0;
+    double cost, minCost = weights->substitutionCost(element, others[0]);
+    for(int i=1; i < terminals.size(); ++i) {
+        cost = weights->substitutionCost(element, others[i]);
+        if(cost < minCost) {
+            minCost = cost;
+            iMin = i;
+        }
+    }
+    return minCost + graph->getCost() - others[iMin]->getCost();
 }
 
 void Problem::computeGraphCost(Graph *g1, Graph *g2, Weights *weights, GraphElement::Type type, int queryIndex, int targetIndex) {
-    Problem *problem = new Problem(Problem::GED, g1, g2, const_cast<Problem *>(this));
     CostIndex costIndex = {type, queryIndex, targetIndex};
+    QByteArray key;
+    if(memo_) {
+        // Each pair of subgraphs is solved once for all the problems
+        double value;
+        key = memo_->getKey(g1, g2);
+        switch(memo_->request(key, const_cast<Problem *>(this), costIndex, &value)) {
+            case SubproblemMemo::SOLVED:
+                addCost(costIndex, value);
+                return;
+            case SubproblemMemo::PENDING:
+                ++waiting_;
+                return;
+            default:
+                break;
+        }
+    }
+    createSubproblem(g1, g2, weights, costIndex, key);
+}
+
+void Problem::createSubproblem(Graph *g1, Graph *g2, Weights *weights, CostIndex costIndex, const QByteArray &key) {
+    Problem *problem = new Problem(Problem::GED, g1, g2, const_cast<Problem *>(this));
+    problem->memoKey_ = key;
     subproblems_.insert(problem, costIndex);
     emit prepare(problem, weights);
 }
 
 void Problem::updateCost(Problem *subproblem, double value) {
+    SubproblemMemo *memo = 0;
+    QByteArray key;
+    bool store = false;
     mutex_.lock();
     if(subproblems_.contains(subproblem)) {
+        // This problem may be deleted once ready, the memo is notified from local copies
+        memo = memo_;
+        key = subproblem->memoKey_;
+        store = !subproblem->isCancelled();
         addCost(subproblems_.value(subproblem), value);
         subproblems_.remove(subproblem);
-        if(subproblems_.isEmpty())
+        if(subproblems_.isEmpty() && !waiting_)
             emit ready(const_cast<Problem *>(this));
         delete subproblem;
     }
     mutex_.unlock();
+    if(memo && !key.isEmpty())
+        memo->resolve(key, value, store);
+}
+
+void Problem::resolveCost(CostIndex costIndex, double value) {
+    mutex_.lock();
+    addCost(costIndex, value);
+    if(--waiting_ == 0 && subproblems_.isEmpty())
+        emit ready(const_cast<Problem *>(this));
+    mutex_.unlock();
+}
+
+void Problem::acquireCost(CostIndex costIndex, const QByteArray &key, Weights *weights) {
+    Graph *g1, *g2;
+    if(costIndex.type == GraphElement::VERTEX) {
+        g1 = query_->getVertex(costIndex.queryIndex)->getGraph();
+        g2 = target_->getVertex(costIndex.targetIndex)->getGraph();
+    } else {
+        g1 = query_->getEdge(costIndex.queryIndex)->getGraph();
+        g2 = target_->getEdge(costIndex.targetIndex)->getGraph();
+    }
+    mutex_.lock();
+    // The subproblem is awaited by this problem, it is not ready in the meantime
+    --waiting_;
+    createSubproblem(g1, g2, weights, costIndex, key);
+    mutex_.unlock();
 }
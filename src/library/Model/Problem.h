@@ -1,9 +1,19 @@
 #ifndef GEMPP_PROBLEM_H
 #define GEMPP_PROBLEM_H
 
+#include <QAtomicInt>
+#include <QMutex>
+#include <QRunnable>
+#include <QSemaphore>
+#include <QThreadPool>
 #include "Graph.h"
+#include "CompactGraph.h"
+#include "CostCache.h"
+#include "CostMatrices.h"
+#include "LabelTable.h"
 #include "Weights.h"
 #include "Core/Matrix.h"
+#include "Core/CancellationToken.h"
 
 typedef struct CostIndex {
         GraphElement::Type type;
@@ -11,6 +21,61 @@ typedef struct CostIndex {
         int targetIndex;
 } CostIndex;
 
+/**
+ * @brief The maximum number of pairs of elements in a tile of the cost matrices.
+ */
+#define GEMPP_COST_TILE 4096
+
+class Problem;
+class SubproblemMemo;
+
+/**
+ * @brief The CostTiles struct holds the state shared by the threads that compute the substitution
+ * costs of the flat elements of a ::Problem. The matrix is cut into tiles, which are ranges of
+ * columns of a row, and each thread takes the next tile until there are none left.
+ */
+struct CostTiles {
+        Problem *problem;
+        const CostProgram *program;
+        const AttributeTable *qTable;
+        const AttributeTable *tTable;
+        QVector<GraphElement *> qElements;
+        QVector<GraphElement *> tElements;
+        QVector<double> tCosts;
+        bool hierarchical;
+        int width;
+        int tileCount;
+        QAtomicInt next;
+        QVector<double> costs;
+        QMutex mutex;
+        QString error;
+
+        /**
+         * @brief Computes tiles until there are none left, or the problem is cancelled.
+         * The first error is kept in CostTiles::error, and stops the other threads.
+         */
+        void work();
+
+        /**
+         * @brief Computes a tile.
+         * @param tile the index of the tile
+         */
+        void compute(int tile);
+};
+
+/**
+ * @brief The CostWorker class helps computing the tiles of some ::CostTiles in a thread of a pool.
+ */
+class CostWorker : public QRunnable {
+    public:
+        CostWorker(CostTiles *tiles, QSemaphore *done);
+        virtual void run();
+
+    private:
+        CostTiles *tiles_;
+        QSemaphore *done_;
+};
+
 class DLL_EXPORT Problem : public QObject, virtual public IPrintable, virtual public ISaveable {
         Q_OBJECT
     public:
@@ -34,13 +99,118 @@ class DLL_EXPORT Problem : public QObject, virtual public IPrintable, virtual pu
         Type getType() const;
         Graph *getQuery() const;
         Graph *getTarget() const;
+
+        /**
+         * @brief Returns the compact structure of the query graph, built with the ::Problem.
+         * @return the compact query graph
+         */
+        const CompactGraph *getCompactQuery() const;
+
+        /**
+         * @brief Returns the compact structure of the target graph, built with the ::Problem.
+         * @return the compact target graph
+         */
+        const CompactGraph *getCompactTarget() const;
         Problem *getParent() const;
+        /**
+         * @brief Returns the substitution cost between two elements.
+         * The costs of the flat edges are evaluated on each request, and not stored: the callers
+         * which read them repeatedly keep the ones they need.
+         * @param type the type of the elements
+         * @param queryIndex the index of the element of the query graph
+         * @param targetIndex the index of the element of the target graph
+         * @return the cost, 0 if the costs have not been computed
+         */
         double getCost(GraphElement::Type type, int queryIndex, int targetIndex) const;
         double getCost(CostIndex costIndex) const;
         void addCost(GraphElement::Type type, int queryIndex, int targetIndex, double value);
         void addCost(CostIndex costIndex, double value);
         void computeCosts(Weights *weights);
 
+        /**
+         * @brief Sets the token used to stop the resolution of this ::Problem and of its subproblems.
+         * @param token the cancellation token, or 0 to disable cancellation
+         */
+        void setCancellationToken(CancellationToken *token);
+
+        /**
+         * @brief Returns the token used to stop the resolution of this ::Problem.
+         * @return the cancellation token, 0 if there is none
+         */
+        CancellationToken *getCancellationToken() const;
+
+        /**
+         * @brief Sets the table from which the costs are read, when it contains both graphs.
+         * The subproblems do not use it.
+         * @param labels the label table, whose costs have been computed, or 0 to compute all the costs
+         */
+        void setLabelTable(const LabelTable *labels);
+
+        /**
+         * @brief Returns the table from which the costs are read.
+         * @return the label table, 0 if there is none
+         */
+        const LabelTable *getLabelTable() const;
+
+        /**
+         * @brief Sets precomputed costs, which replace the computation of the costs of this ::Problem.
+         * The creation costs of the elements of both graphs are overwritten.
+         * @param costs the costs, owned by the problem afterwards, or 0 to compute the costs
+         */
+        void setCostMatrices(CostMatrices *costs);
+
+        /**
+         * @brief Returns the precomputed costs.
+         * @return the costs, 0 if there are none
+         */
+        const CostMatrices *getCostMatrices() const;
+
+        /**
+         * @brief Sets the cache from which the costs are read, and to which they are written once computed.
+         * @param cache the cost cache, or 0 to disable caching
+         */
+        void setCostCache(CostCache *cache);
+
+        /**
+         * @brief Returns the cache of the costs.
+         * @return the cost cache, 0 if there is none
+         */
+        CostCache *getCostCache() const;
+
+        /**
+         * @brief Sets the memo of the values of the subproblems, shared with the subproblems of this ::Problem.
+         * @param memo the memo, or 0 to solve every subproblem
+         */
+        void setSubproblemMemo(SubproblemMemo *memo);
+
+        /**
+         * @brief Returns the memo of the values of the subproblems.
+         * @return the memo, 0 if there is none
+         */
+        SubproblemMemo *getSubproblemMemo() const;
+
+        /**
+         * @brief Adds the value of a subproblem solved for another ::Problem, which this one was waiting for.
+         * @param costIndex the cost to which the value is added
+         * @param value the value of the subproblem
+         */
+        void resolveCost(CostIndex costIndex, double value);
+
+        /**
+         * @brief Solves a subproblem which this ::Problem was waiting for, since its resolution
+         * for another ::Problem has been cancelled.
+         * @param costIndex the cost to which the value is added
+         * @param key the key of the subproblem in the memo
+         * @param weights the cost weights to apply
+         */
+        void acquireCost(CostIndex costIndex, const QByteArray &key, Weights *weights);
+
+        /**
+         * @brief Indicates whether the resolution of this ::Problem has been cancelled or has reached its deadline.
+         * @return a boolean
+         */
+        bool isCancelled() const;
+
         void print(Printer *p);
         void save(const QString &filename);
 
@@ -59,20 +229,107 @@ class DLL_EXPORT Problem : public QObject, virtual public IPrintable, virtual pu
         void ready(Problem *problem);
 
     protected:
+        void computeVertexCosts(Weights *weights, const CostProgram *program, const AttributeTable *qTable, const AttributeTable *tTable);
+
+        /**
+         * @brief Gathers the vertex substitution costs from the label table.
+         */
+        void computeVertexCosts();
+
+        /**
+         * @brief Computes the substitution costs of the pairs of edges involving a hierarchical edge,
+         * which are never evaluated on demand.
+         * @param weights the cost weights
+         */
+        void computeEdgeCosts(Weights *weights);
+
+        /**
+         * @brief Evaluates the substitution cost between two flat edges.
+         * @param queryIndex the index of the edge of the query graph
+         * @param targetIndex the index of the edge of the target graph
+         * @return the cost
+         */
+        double getEdgeCost(int queryIndex, int targetIndex) const;
+
+        /**
+         * @brief Returns the key of a pair of edges in Problem::eCosts_.
+         * @param queryIndex the index of the edge of the query graph
+         * @param targetIndex the index of the edge of the target graph
+         * @return the key
+         */
+        qint64 getEdgeKey(int queryIndex, int targetIndex) const;
+
+        /**
+         * @brief Releases the tables from which the edge costs are evaluated.
+         */
+        void clearEdgeCosts();
+
+        /**
+         * @brief Reads the creation and vertex substitution costs from the precomputed costs.
+         */
+        void loadCosts();
         double computeCost(GraphElement *element, Graph *graph, Weights *weights);
         void computeGraphCost(Graph *g1, Graph *g2, Weights *weights, GraphElement::Type type, int queryIndex, int targetIndex);
+        void createSubproblem(Graph *g1, Graph *g2, Weights *weights, CostIndex costIndex, const QByteArray &key);
 
     private slots:
         void updateCost(Problem *subproblem, double value);
 
     private:
+        /**
+         * @brief Returns the pool shared by all the problems to compute their costs.
+         * It is distinct from the global pool, whose threads are busy solving the problems.
+         * @return the pool
+         */
+        static QThreadPool *costPool();
+
         Type type_;
         Graph *query_;
         Graph *target_;
+        CompactGraph *compactQuery_;
+        CompactGraph *compactTarget_;
         Problem *parent_;
+        CancellationToken *token_;
+        const LabelTable *labels_;
+        CostMatrices *costs_;
+        CostCache *cache_;
         Matrix<double> vCosts_;
-        Matrix<double> eCosts_;
+
+        /**
+         * @brief The attributes of the edges and their compiled weights, from which the edge
+         * substitution costs are evaluated on demand instead of being stored in a dense matrix.
+         */
+        AttributeSchema *eSchema_;
+        AttributeTable *qeTable_;
+        AttributeTable *teTable_;
+        CostProgram *eProgram_;
+
+        /**
+         * @brief The labels of the edges of both graphs, when their costs are read from the label table.
+         */
+        const QVector<int> *qeLabels_;
+        const QVector<int> *teLabels_;
+
+        /**
+         * @brief The substitution costs of the pairs of edges which involve a hierarchical edge or to
+         * which a value has been added, stored sparsely, and the mutex protecting them.
+         */
+        mutable QHash<qint64, double> eCosts_;
+        mutable QMutex eMutex_;
+
+        /**
+         * @brief Whether Problem::eCosts_ may hold costs, so that the flat problems read no map and take no lock.
+         */
+        QAtomicInt eStored_;
         QMap<Problem *, CostIndex> subproblems_;
+
+        /**
+         * @brief The memo of the subproblems, the key of this ::Problem in the memo if it is a subproblem,
+         * and the number of values of subproblems solved for other problems which are still awaited.
+         */
+        SubproblemMemo *memo_;
+        QByteArray memoKey_;
+        int waiting_;
         QMutex mutex_;
 };
 
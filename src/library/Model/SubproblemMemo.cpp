@@ -0,0 +1,81 @@
+#include <QCryptographicHash>
+#include "SubproblemMemo.h"
+
+SubproblemMemo::SubproblemMemo(Weights *weights) : weights_(weights), weightsHash_(weights->getHash()) {}
+
+SubproblemMemo::~SubproblemMemo() {}
+
+QByteArray SubproblemMemo::getHash(const Graph *graph) {
+    if(!hashes_.contains(graph))
+        hashes_.insert(graph, graph->getCanonicalHash());
+    return hashes_.value(graph);
+}
+
+QByteArray SubproblemMemo::getKey(const Graph *query, const Graph *target) {
+    QMutexLocker locker(&mutex_);
+    QPair<const Graph *, const Graph *> pair(query, target);
+    if(keys_.contains(pair))
+        return keys_.value(pair);
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(getHash(query));
+    hash.addData(getHash(target));
+    hash.addData(weightsHash_);
+    QByteArray key = hash.result();
+
+    // The pairs sharing the hashes are told apart by an isomorphism check with the first pair of each class
+    QList<QPair<const Graph *, const Graph *> > &representatives = representatives_[key];
+    int r = 0;
+    while(r < representatives.size() && !(query->isIsomorphic(representatives[r].first) && target->isIsomorphic(representatives[r].second)))
+        ++r;
+    if(r == representatives.size())
+        representatives.append(pair);
+    key.append(QByteArray::number(r));
+    keys_.insert(pair, key);
+    return key;
+}
+
+SubproblemMemo::Status SubproblemMemo::request(const QByteArray &key, Problem *problem, CostIndex costIndex, double *value) {
+    QMutexLocker locker(&mutex_);
+    if(values_.contains(key)) {
+        *value = values_.value(key);
+        return SOLVED;
+    }
+    if(waiters_.contains(key)) {
+        waiters_[key].append(qMakePair(problem, costIndex));
+        return PENDING;
+    }
+    waiters_.insert(key, QList<QPair<Problem *, CostIndex> >());
+    return ACQUIRED;
+}
+
+void SubproblemMemo::resolve(const QByteArray &key, double value, bool store) {
+    QList<QPair<Problem *, CostIndex> > waiters, cancelled;
+    QPair<Problem *, CostIndex> acquirer(0, CostIndex());
+    mutex_.lock();
+    waiters = waiters_.take(key);
+    if(store) {
+        values_.insert(key, value);
+    } else {
+        // The value of a cancelled subproblem is only right for the waiters which are cancelled as well
+        while(!waiters.isEmpty() && waiters.first().first->isCancelled())
+            cancelled.append(waiters.takeFirst());
+        if(!waiters.isEmpty()) {
+            acquirer = waiters.takeFirst();
+            waiters_.insert(key, waiters);
+        }
+        waiters = cancelled;
+    }
+    mutex_.unlock();
+
+    // The waiters lock themselves, which must not happen while holding the memo
+    for(auto waiter : waiters)
+        waiter.first->resolveCost(waiter.second, value);
+    if(acquirer.first)
+        acquirer.first->acquireCost(acquirer.second, key, weights_);
+}
+
+int SubproblemMemo::getCount() const {
+    QMutexLocker locker(&mutex_);
+    return values_.size();
+}
@@ -0,0 +1,98 @@
+#ifndef GEMPP_SUBPROBLEMMEMO_H
+#define GEMPP_SUBPROBLEMMEMO_H
+
+#include <QMutex>
+#include "Problem.h"
+
+/**
+ * @brief The SubproblemMemo class keeps the values of the subproblems solved for the hierarchical
+ * elements of the ::Problem, so that each pair of subgraphs, e.g. two identical cycles of molecules,
+ * is solved once for all the problems of a run.
+ *
+ * The pairs are identified by the canonical hashes of both subgraphs, so that the order of their
+ * vertices and edges does not matter, and the pairs sharing the hashes are confirmed with an
+ * isomorphism check. The subgraphs must therefore live as long as the memo. When a pair is requested
+ * while it is being solved, the requester waits for the result instead of solving it again. If the
+ * resolution is cancelled, the subproblem is handed to the first waiter which is not cancelled.
+ *
+ * All the methods are thread-safe.
+ * @see Problem
+ */
+class DLL_EXPORT SubproblemMemo {
+    public:
+        /**
+         * @brief Indicates how a request has been answered.
+         */
+        enum Status {
+            SOLVED = 0, /**< the value is already known */
+            PENDING, /**< the subproblem is being solved, the requester will be notified */
+            ACQUIRED /**< the requester has to solve the subproblem */
+        };
+
+        /**
+         * @brief Constructs a new SubproblemMemo object.
+         * @param weights the weights used to compute the costs, hashed at once
+         */
+        SubproblemMemo(Weights *weights);
+
+        /**
+         * @brief Destructs a SubproblemMemo object.
+         */
+        ~SubproblemMemo();
+
+        /**
+         * @brief Returns the key of a pair of subgraphs.
+         * @param query the query subgraph
+         * @param target the target subgraph
+         * @return the key
+         */
+        QByteArray getKey(const Graph *query, const Graph *target);
+
+        /**
+         * @brief Requests the value of a subproblem.
+         * @param key the key of the subproblem
+         * @param problem the problem which needs the value, notified with Problem::resolveCost if it is pending
+         * @param costIndex the cost of the problem to which the value is added
+         * @param value the value, if it is already known
+         * @return the status of the request
+         */
+        Status request(const QByteArray &key, Problem *problem, CostIndex costIndex, double *value);
+
+        /**
+         * @brief Notifies the problems waiting for a subproblem of its value. If the subproblem has been
+         * cancelled, its value is only given to the cancelled waiters, and the first other waiter solves it again.
+         * @param key the key of the subproblem
+         * @param value the value
+         * @param store whether the value is kept for the next requests, i.e. the subproblem has not been cancelled
+         */
+        void resolve(const QByteArray &key, double value, bool store);
+
+        /**
+         * @brief Returns the number of values kept.
+         * @return the count
+         */
+        int getCount() const;
+
+    private:
+        QByteArray getHash(const Graph *graph);
+
+        Weights *weights_;
+        QByteArray weightsHash_;
+        QHash<const Graph *, QByteArray> hashes_;
+
+        /**
+         * @brief The key of each pair of subgraphs, and the first pair of each class of isomorphic pairs
+         * for each hash.
+         */
+        QHash<QPair<const Graph *, const Graph *>, QByteArray> keys_;
+        QHash<QByteArray, QList<QPair<const Graph *, const Graph *> > > representatives_;
+        QHash<QByteArray, double> values_;
+
+        /**
+         * @brief The problems waiting for each subproblem being solved.
+         */
+        QHash<QByteArray, QList<QPair<Problem *, CostIndex> > > waiters_;
+        mutable QMutex mutex_;
+};
+
+#endif /* GEMPP_SUBPROBLEMMEMO_H */
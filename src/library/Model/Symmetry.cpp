@@ -0,0 +1,246 @@
+#include <algorithm>
+#include "Symmetry.h"
+#include "Core/StringPool.h"
+
+Symmetry::Symmetry(Graph *graph, int maxNodes) : n_(graph->getVertexCount()), colorCount_(0), maxNodes_(maxNodes), nodes_(0) {
+    // Initial colours, the hierarchical vertices are never exchanged
+    QStringList signatures;
+    for(int i=0; i < n_; ++i) {
+        Vertex *v = graph->getVertex(i);
+        signatures.append(v->getGraph() ? QString("#%1").arg(i) : signature(v));
+    }
+    QStringList sorted = signatures.toSet().toList();
+    std::sort(sorted.begin(), sorted.end());
+    QHash<QString, int> ranks;
+    for(int c=0; c < sorted.size(); ++c)
+        ranks.insert(sorted[c], c);
+    colorCount_ = sorted.size();
+    colors_ = QVector<int>(n_);
+    for(int i=0; i < n_; ++i)
+        colors_[i] = ranks.value(signatures[i]);
+
+    // Arcs, the hierarchical edges are never exchanged
+    QHash<QString, int> edgeColors;
+    QString s;
+    int c, i, j;
+    bool isDirected = (graph->getType() == Graph::DIRECTED);
+    arcs_ = QVector< QVector< QPair<int, int> > >(n_);
+    for(int ij=0; ij < graph->getEdgeCount(); ++ij) {
+        Edge *e = graph->getEdge(ij);
+        s = e->getGraph() ? QString("#%1").arg(ij) : signature(e);
+        if(!edgeColors.contains(s))
+            edgeColors.insert(s, edgeColors.size());
+        c = edgeColors.value(s);
+        i = e->getOrigin()->getIndex();
+        j = e->getTarget()->getIndex();
+        arcs_[i].append(qMakePair(j, 2*c));
+        arcs_[j].append(qMakePair(i, isDirected ? 2*c+1 : 2*c));
+    }
+    for(auto &arcs : arcs_)
+        std::sort(arcs.begin(), arcs.end());
+}
+
+Symmetry::~Symmetry() {}
+
+QVector<int> Symmetry::refine(const QList<int> &fixed) const {
+    QVector<int> colors = colors_;
+    for(int p=0; p < fixed.size(); ++p)
+        colors[fixed[p]] = colorCount_ + p;
+
+    QVector< QVector<int> > signatures(n_);
+    QVector< QPair<int, int> > neighbours;
+    QVector<int> order(n_);
+    int count = -1, newCount;
+    forever {
+        // The signature of a vertex is its colour, followed by the sorted colours of its arcs and neighbours
+        for(int v=0; v < n_; ++v) {
+            neighbours.clear();
+            for(auto arc : arcs_[v])
+                neighbours.append(qMakePair(arc.second, colors[arc.first]));
+            std::sort(neighbours.begin(), neighbours.end());
+            QVector<int> &s = signatures[v];
+            s.clear();
+            s.append(colors[v]);
+            for(auto p : neighbours) {
+                s.append(p.first);
+                s.append(p.second);
+            }
+        }
+
+        // The new colours are the ranks of the signatures, so that they do not depend on the vertex indexes
+        for(int v=0; v < n_; ++v)
+            order[v] = v;
+        std::sort(order.begin(), order.end(), [&signatures](int u, int v) {
+            return std::lexicographical_compare(signatures[u].begin(), signatures[u].end(), signatures[v].begin(), signatures[v].end());
+        });
+        newCount = 0;
+        for(int r=0; r < n_; ++r) {
+            if(r > 0 && signatures[order[r]] != signatures[order[r-1]])
+                ++newCount;
+            colors[order[r]] = newCount;
+        }
+        if(n_ > 0)
+            ++newCount;
+
+        // The partition is equitable when no colour class has been split
+        if(newCount == count)
+            break;
+        count = newCount;
+    }
+    return colors;
+}
+
+QList<int> Symmetry::getOrbit(int v, const QList<int> &fixed) {
+    QVector<int> colors = refine(fixed);
+
+    // Merges the vertices exchanged by the automorphisms found so far
+    QVector<int> parent(n_);
+    for(int u=0; u < n_; ++u)
+        parent[u] = u;
+    auto find = [&parent](int u) {
+        while(parent[u] != u) {
+            parent[u] = parent[parent[u]];
+            u = parent[u];
+        }
+        return u;
+    };
+
+    QVector<int> mapping;
+    for(int w=0; w < n_; ++w) {
+        if(w == v || colors[w] != colors[v] || find(w) == find(v))
+            continue;
+        switch(search(fixed + (QList<int>() << v), fixed + (QList<int>() << w), mapping)) {
+            case FOUND:
+                for(int u=0; u < n_; ++u)
+                    parent[find(u)] = find(mapping[u]);
+                break;
+            case NOT_FOUND:
+                break;
+            case ABORTED:
+                return QList<int>();
+        }
+    }
+
+    QList<int> orbit;
+    for(int u=0; u < n_; ++u)
+        if(colors[u] == colors[v] && find(u) == find(v))
+            orbit.append(u);
+    return orbit;
+}
+
+QList<Orbit> Symmetry::getStabilizerChain() {
+    QList<Orbit> chain;
+    QList<int> fixed, orbit;
+    QVector<int> colors;
+    bool found = true;
+    nodes_ = 0;
+    while(found && nodes_ <= maxNodes_) {
+        found = false;
+
+        // The non-trivial cells of the partition, the largest first
+        colors = refine(fixed);
+        QMap<int, QList<int> > cells;
+        for(int v=0; v < n_; ++v)
+            cells[colors[v]].append(v);
+        QList< QList<int> > candidates;
+        for(auto cell : cells)
+            if(cell.size() > 1)
+                candidates.append(cell);
+        std::stable_sort(candidates.begin(), candidates.end(), [](const QList<int> &c1, const QList<int> &c2) {
+            return c1.size() > c2.size();
+        });
+
+        // Fixes the representative of the first non-trivial orbit
+        for(auto cell : candidates) {
+            orbit = getOrbit(cell.first(), fixed);
+            if(orbit.size() > 1) {
+                chain.append(qMakePair(cell.first(), orbit));
+                fixed.append(cell.first());
+                found = true;
+                break;
+            }
+            if(nodes_ > maxNodes_)
+                break;
+        }
+    }
+    return chain;
+}
+
+double Symmetry::getGroupOrder(const QList<Orbit> &chain) {
+    double order = 1;
+    for(auto orbit : chain)
+        order *= orbit.second.size();
+    return order;
+}
+
+Symmetry::Status Symmetry::search(const QList<int> &a, const QList<int> &b, QVector<int> &mapping) {
+    if(++nodes_ > maxNodes_)
+        return ABORTED;
+
+    QVector<int> ca = refine(a);
+    QVector<int> cb = refine(b);
+    QVector<int> ha = ca, hb = cb;
+    std::sort(ha.begin(), ha.end());
+    std::sort(hb.begin(), hb.end());
+    if(ha != hb)
+        return NOT_FOUND;
+
+    // A discrete partition defines the only candidate mapping
+    int count = ha.isEmpty() ? 0 : ha.last() + 1;
+    if(count == n_) {
+        QVector<int> inverse(n_);
+        for(int u=0; u < n_; ++u)
+            inverse[cb[u]] = u;
+        mapping = QVector<int>(n_);
+        for(int v=0; v < n_; ++v)
+            mapping[v] = inverse[ca[v]];
+        return isAutomorphism(mapping) ? FOUND : NOT_FOUND;
+    }
+
+    // Individualizes the first vertex of the first non-trivial cell, and tries all its possible images
+    QVector<int> sizes(count, 0);
+    for(int v=0; v < n_; ++v)
+        ++sizes[ca[v]];
+    int cell = 0;
+    while(sizes[cell] < 2)
+        ++cell;
+    int va = 0;
+    while(ca[va] != cell)
+        ++va;
+    Status status;
+    for(int vb=0; vb < n_; ++vb) {
+        if(cb[vb] != cell)
+            continue;
+        status = search(a + (QList<int>() << va), b + (QList<int>() << vb), mapping);
+        if(status != NOT_FOUND)
+            return status;
+    }
+    return NOT_FOUND;
+}
+
+bool Symmetry::isAutomorphism(const QVector<int> &mapping) const {
+    QVector< QPair<int, int> > image;
+    for(int v=0; v < n_; ++v) {
+        if(colors_[v] != colors_[mapping[v]])
+            return false;
+        image.clear();
+        for(auto arc : arcs_[v])
+            image.append(qMakePair(mapping[arc.first], arc.second));
+        std::sort(image.begin(), image.end());
+        if(image != arcs_[mapping[v]])
+            return false;
+    }
+    return true;
+}
+
+QString Symmetry::signature(GraphElement *element) {
+    // The separators are control characters that can not be found in GXL or GML files
+    QStringList sl;
+    const Attribute *att;
+    for(int rank = 0; rank < element->getAttributeCount(); ++rank) {
+        att = element->getAttribute(rank);
+        sl.append(StringPool::get(element->getAttributeID(rank)) + QChar(0x1E) + Attribute::toName(att->getType()) + QChar(0x1E) + att->getValue().toString());
+    }
+    sl.append(QString::number(element->getCost(), 'g', 17));
+    return sl.join(QChar(0x1F));
+}
@@ -0,0 +1,140 @@
+#ifndef GEMPP_SYMMETRY_H
+#define GEMPP_SYMMETRY_H
+
+#include <QVector>
+#include <QPair>
+#include "Graph.h"
+
+/**
+ * @brief The ::Orbit type represents an orbit of vertices (by their indexes) as
+ * a pair, whose first element is the representative of the orbit.
+ */
+typedef QPair<int, QList<int> > Orbit;
+
+/**
+ * @brief The Symmetry class computes the automorphisms of a ::Graph, i.e. the
+ * permutations of its vertices that preserve the edges as well as the attributes
+ * and costs of all elements. Two vertices exchanged by an automorphism play the
+ * exact same role in any matching problem, which allows to break the symmetries
+ * of the formulations.
+ *
+ * The vertices are first partitioned using colour refinement (1-dimensional
+ * Weisfeiler-Lehman), then the orbits are obtained by an individualization-refinement
+ * search of automorphisms. The search is bounded by a maximal number of nodes, an
+ * orbit whose search did not complete is never returned.
+ *
+ * @author J.Lerouge <julien.lerouge@litislab.fr>
+ * @see Formulation::breakSymmetries
+ */
+class DLL_EXPORT Symmetry {
+    public:
+        /**
+         * @brief Constructs a new Symmetry object.
+         * @param graph the graph
+         * @param maxNodes the maximal number of nodes explored by the automorphism searches
+         */
+        Symmetry(Graph *graph, int maxNodes = 10000);
+
+        /**
+         * @brief Destructs a Symmetry object.
+         */
+        virtual ~Symmetry();
+
+        /**
+         * @brief Computes the coarsest equitable partition of the vertices by colour refinement,
+         * the given vertices being individualized in this order.
+         * @param fixed the individualized vertices
+         * @return the colour of each vertex
+         */
+        QVector<int> refine(const QList<int> &fixed = QList<int>()) const;
+
+        /**
+         * @brief Computes the orbit of a vertex under the automorphisms that fix some vertices.
+         * @param v the vertex
+         * @param fixed the vertices fixed by the automorphisms
+         * @return the orbit of v (sorted by index), or an empty list if the search did not complete
+         */
+        QList<int> getOrbit(int v, const QList<int> &fixed = QList<int>());
+
+        /**
+         * @brief Computes a stabilizer chain : each orbit is computed under the automorphisms
+         * that fix the representatives of the previous orbits. Requiring each representative to
+         * be matched before the other vertices of its orbit, for every orbit of the chain,
+         * keeps at least one optimal solution of any matching problem.
+         * @return the orbits of the chain
+         */
+        QList<Orbit> getStabilizerChain();
+
+        /**
+         * @brief Returns the number of automorphisms that are described by a stabilizer chain.
+         * @param chain the stabilizer chain
+         * @return the product of the sizes of the orbits
+         */
+        static double getGroupOrder(const QList<Orbit> &chain);
+
+    private:
+        /**
+         * @brief The status of an automorphism search.
+         */
+        enum Status {
+            FOUND, /**< an automorphism has been found */
+            NOT_FOUND, /**< there is no such automorphism */
+            ABORTED /**< the search has exceeded the maximal number of nodes */
+        };
+
+        /**
+         * @brief The number of vertices.
+         */
+        int n_;
+
+        /**
+         * @brief The initial colour of each vertex, based on its attributes.
+         */
+        QVector<int> colors_;
+
+        /**
+         * @brief The number of initial colours.
+         */
+        int colorCount_;
+
+        /**
+         * @brief The arcs of each vertex, as sorted pairs (neighbour, arc colour).
+         * An arc colour is based on the attributes of the edge and on its direction.
+         */
+        QVector< QVector< QPair<int, int> > > arcs_;
+
+        /**
+         * @brief The maximal number of nodes explored by the searches.
+         */
+        int maxNodes_;
+
+        /**
+         * @brief The number of nodes explored so far.
+         */
+        int nodes_;
+
+        /**
+         * @brief Searches an automorphism that maps a sequence of vertices onto another one.
+         * @param a the sequence of vertices
+         * @param b the sequence of their images
+         * @param mapping the automorphism, if one is found
+         * @return the status of the search
+         */
+        Status search(const QList<int> &a, const QList<int> &b, QVector<int> &mapping);
+
+        /**
+         * @brief Tests whether a permutation of the vertices is an automorphism.
+         * @param mapping the permutation
+         * @return a boolean
+         */
+        bool isAutomorphism(const QVector<int> &mapping) const;
+
+        /**
+         * @brief Returns a string that identifies the attributes and the cost of an element.
+         * @param element the element
+         * @return the signature
+         */
+        static QString signature(GraphElement *element);
+};
+
+#endif /* GEMPP_SYMMETRY_H */
@@ -1,4 +1,6 @@
 #include "Weights.h"
+#include <QReadWriteLock>
+#include "Core/StringPool.h"
 
 const char* Weights::operationName[Weights::COUNT] = {
     "Creation",
@@ -56,6 +58,29 @@ Weight *Weights::getWeightOrDefault(Operation op, GraphElement::Type t, QString
     return getWeight(op, t, attribute);
 }
 
+const Weight *Weights::findWeight(Operation op, GraphElement::Type t, const QString &attribute, QMetaType::Type attributeType) const {
+    WeightHash *wh = getWeights(op, t);
+    auto it = wh->constFind(attribute);
+    if(it != wh->constEnd())
+        return it.value();
+    // The default weights only depend on the operation and on the type of the attribute
+    static Weight defaults[COUNT][Weight::COUNT] = {
+        {
+            {Weight::CONSTANT, GEMPP_DEFAULT_C_POWER, GEMPP_DEFAULT_C_ATTR},
+            {Weight::DISCRETE, GEMPP_DEFAULT_C_POWER, GEMPP_DEFAULT_C_ATTR},
+            {Weight::NUMERIC, GEMPP_DEFAULT_C_POWER, GEMPP_DEFAULT_C_ATTR},
+            {Weight::STRING, GEMPP_DEFAULT_C_POWER, GEMPP_DEFAULT_C_ATTR}
+        },
+        {
+            {Weight::CONSTANT, GEMPP_DEFAULT_S_POWER, GEMPP_DEFAULT_S_ATTR},
+            {Weight::DISCRETE, GEMPP_DEFAULT_S_POWER, GEMPP_DEFAULT_S_ATTR},
+            {Weight::NUMERIC, GEMPP_DEFAULT_S_POWER, GEMPP_DEFAULT_S_ATTR},
+            {Weight::STRING, GEMPP_DEFAULT_S_POWER, GEMPP_DEFAULT_S_ATTR}
+        }
+    };
+    return &defaults[op][getDefaultType(attributeType)];
+}
+
 void Weights::addWeight(Operation op, GraphElement::Type t, QString attribute, Weight::Type type, uint power, double value) {
     Weight *w;
     //Exception(QString("Weights object already contains a %1 weight for %2 attribute \"%3\".").arg(toName(op), GraphElement::toName(t), attribute));
@@ -169,6 +194,39 @@ void Weights::toXML() {
     document()->appendChild(weights);
 }
 
+QByteArray Weights::getHash() const {
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    WeightHash *wh;
+    Weight *w;
+    QStringList keys;
+    uint power;
+    double value;
+    for(Operation op = (Operation)0; op < COUNT; op = (Operation)((int)op + 1)) {
+        value = getDefaultWeight(op);
+        power = getDefaultPower(op);
+        hash.addData((const char *) &value, sizeof(double));
+        hash.addData((const char *) &power, sizeof(uint));
+        for(GraphElement::Type t = (GraphElement::Type)0; t < GraphElement::COUNT; t = (GraphElement::Type)((int)t + 1)) {
+            wh = getWeights(op, t);
+            hash.addData(WeightHash::toName(wh->getMode()).toUtf8());
+            hash.addData(QByteArray::number(wh->getRoot()));
+            // The weights are hashed in the order of their names
+            keys = wh->keys();
+            keys.sort();
+            for(const QString &key : keys) {
+                w = wh->value(key);
+                power = w->getPower();
+                value = w->getValue();
+                hash.addData(key.toUtf8());
+                hash.addData(Weight::toName(w->getType()).toUtf8());
+                hash.addData((const char *) &power, sizeof(uint));
+                hash.addData((const char *) &value, sizeof(double));
+            }
+        }
+    }
+    return hash.result();
+}
+
 Weights::Operation Weights::getCurrentOperation() const {
     return currentOperation_;
 }
@@ -181,19 +239,26 @@ double Weights::creationCost(GraphElement *e) {
     return weightedCost(e);
 }
 
+static const Attribute *sameAttribute(GraphElement *e1, int rank, GraphElement *e2) {
+    int other = e2->getAttributeRank(e1->getAttributeID(rank));
+    if(other < 0)
+        Exception(QString("%1 element \"%2\" has no attribute \"%3\"").arg(GraphElement::toName(e2->getType()), e2->getID(), StringPool::get(e1->getAttributeID(rank))));
+    return e2->getAttribute(other);
+}
+
 double Weights::substitutionCost(GraphElement *e1, GraphElement *e2) {
     if(e1->getType() != e2->getType())
         Exception(QString("There are no possible substitutions between elements of different types"));
 
-    Attribute *att;
-    Weight *w;
+    const Attribute *att;
+    const Weight *w;
     // Test if all symbolic attributes of e1 and e2 are the same
-    for(auto name : e1->getAttributes().keys()) {
-        att = e1->getAttribute(name);
-        w = getWeightOrDefault(SUBSTITUTION, e1->getType(), name, att->getType());
+    for(int rank = 0; rank < e1->getAttributeCount(); ++rank) {
+        att = e1->getAttribute(rank);
+        w = findWeight(SUBSTITUTION, e1->getType(), StringPool::get(e1->getAttributeID(rank)), att->getType());
         // Compare only symbolic attributes that have non-zero weight,
         // and test if e1 and e2 have at least one different symbolic attribute
-        if((w->getType() == Weight::DISCRETE) && (w->getValue() != 0) && (att->getValue() != e2->getAttribute(name)->getValue()))
+        if((w->getType() == Weight::DISCRETE) && (w->getValue() != 0) && (att->getValue() != sameAttribute(e1, rank, e2)->getValue()))
             return e1->getCost() + e2->getCost();
     }
 
@@ -201,15 +266,31 @@ double Weights::substitutionCost(GraphElement *e1, GraphElement *e2) {
     return weightedCost(e1, e2);
 }
 
+CostProgram Weights::compile(const AttributeSchema *schema, GraphElement::Type t) {
+    QVector<CostProgram::Term> terms;
+    const Weight *w;
+    for(int c : schema->getColumns()) {
+        w = findWeight(SUBSTITUTION, t, StringPool::get(schema->getName(c)), schema->getType(c));
+        // A symbolic attribute without weight has no influence on the cost
+        if((w->getType() == Weight::DISCRETE) && (w->getValue() == 0))
+            continue;
+        CostProgram::Term term = {c, w->getType(), w->getValue(), w->getPower()};
+        terms.append(term);
+    }
+    w = getWeight(SUBSTITUTION, t, GEMPP_CONST_LABEL);
+    WeightHash *wh = getWeights(SUBSTITUTION, t);
+    return CostProgram(schema, ipow(w->getValue(), w->getPower()), wh->getMode(), wh->getRoot(), terms);
+}
+
 double Weights::weightedCost(GraphElement *e1, GraphElement *e2) {
     Operation op = (e2 == 0)? CREATION : SUBSTITUTION;
     GraphElement::Type eltype = e1->getType();
-    Weight *w = getWeight(op, eltype, GEMPP_CONST_LABEL);
-    double total_cost = pow(w->getValue(), w->getPower());
+    const Weight *w = getWeight(op, eltype, GEMPP_CONST_LABEL);
+    double total_cost = ipow(w->getValue(), w->getPower());
     double cost;
 
-    for(auto key : e1->getAttributes().keys()) {
-        w = getWeightOrDefault(op, eltype, key);
+    for(int rank = 0; rank < e1->getAttributeCount(); ++rank) {
+        w = findWeight(op, eltype, StringPool::get(e1->getAttributeID(rank)), e1->getAttribute(rank)->getType());
 
         // Evaluate only non symbolic attributes
         if(w->getType() == Weight::DISCRETE)
@@ -220,10 +301,10 @@ double Weights::weightedCost(GraphElement *e1, GraphElement *e2) {
             case SUBSTITUTION:
                 switch(w->getType()) {
                     case Weight::NUMERIC:
-                        cost = e1->getAttribute(key)->getValue().toDouble() - e2->getAttribute(key)->getValue().toDouble();
+                        cost = e1->getAttribute(rank)->getValue().toDouble() - sameAttribute(e1, rank, e2)->getValue().toDouble();
                         break;
                     case Weight::STRING:
-                        cost = levenshtein(e1->getAttribute(key)->getValue().toString(), e2->getAttribute(key)->getValue().toString());
+                        cost = levenshtein(e1->getAttribute(rank)->getValue().toString(), sameAttribute(e1, rank, e2)->getValue().toString());
                         break;
                     default:
                         break;
@@ -232,10 +313,10 @@ double Weights::weightedCost(GraphElement *e1, GraphElement *e2) {
             case CREATION:
                 switch(w->getType()) {
                     case Weight::NUMERIC:
-                        cost = e1->getAttribute(key)->getValue().toDouble();
+                        cost = e1->getAttribute(rank)->getValue().toDouble();
                         break;
                     case Weight::STRING:
-                        cost = e1->getAttribute(key)->getValue().toString().size();
+                        cost = e1->getAttribute(rank)->getValue().toString().size();
                         break;
                     default:
                         break;
@@ -244,7 +325,7 @@ double Weights::weightedCost(GraphElement *e1, GraphElement *e2) {
             default:
                 break;
         }
-        cost = pow(fabs(w->getValue()*cost), w->getPower());
+        cost = ipow(fabs(w->getValue()*cost), w->getPower());
         switch(getWeights(op, eltype)->getMode()) {
             case WeightHash::ADD:
                 total_cost += cost;
@@ -278,17 +359,158 @@ void operator+=(Weights &w1, Weights w2) {
                 w1.getWeight(op, t, it.key())->value() += w2.getWeight(op, t, it.key())->getValue();
 }
 
-uint levenshtein(QString s1, QString s2) {
-    const int len1 = s1.size(), len2 = s2.size();
-    QVector<uint> col(len2+1), prevCol(len2+1);
-    for (int i = 0; i < prevCol.size(); i++)
-        prevCol[i] = i;
-    for (int i = 0; i < len1; i++) {
-        col[0] = i+1;
-        for (int j = 0; j < len2; j++)
-            col[j+1] = qMin(qMin(prevCol[1 + j] + 1, col[j] + 1),
-                    prevCol[j] + (s1[i]==s2[j] ? 0 : 1));
-        col.swap(prevCol);
+/**
+ * @brief The bit masks of the positions of each character in a pattern, by blocks of 64 characters.
+ * The Latin-1 characters are looked up directly, the few other ones linearly.
+ */
+struct PatternMasks {
+    PatternMasks(const ushort *p, int m) : blocks((m + 63)/64), latin(blocks*256, 0) {
+        quint64 bit;
+        int j;
+        for(int i=0; i < m; ++i) {
+            bit = quint64(1) << (i % 64);
+            if(p[i] < 256) {
+                latin[(i/64)*256 + p[i]] |= bit;
+            } else {
+                for(j=0; j < others.size() && others[j] != p[i]; ++j);
+                if(j == others.size()) {
+                    others.append(p[i]);
+                    otherMasks.resize(otherMasks.size() + blocks);
+                    for(int b = j*blocks; b < otherMasks.size(); ++b)
+                        otherMasks[b] = 0;
+                }
+                otherMasks[j*blocks + i/64] |= bit;
+            }
+        }
+    }
+
+    quint64 get(int block, ushort c) const {
+        if(c < 256)
+            return latin[block*256 + c];
+        for(int j=0; j < others.size(); ++j)
+            if(others[j] == c)
+                return otherMasks[j*blocks + block];
+        return 0;
+    }
+
+    int blocks;
+    QVector<quint64> latin;
+    QVector<ushort> others;
+    QVector<quint64> otherMasks;
+};
+
+/**
+ * @brief Computes the edit distance with the bit-parallel algorithm of Myers, as formulated by Hyyrö,
+ * each column of the dynamic programming matrix being encoded by its vertical deltas.
+ * The pattern is processed by blocks of 64 characters, the horizontal deltas being carried from a block to the next.
+ * @param p the pattern
+ * @param m the length of the pattern, greater than 0
+ * @param t the text
+ * @param n the length of the text
+ * @return the distance
+ */
+static uint myers(const ushort *p, int m, const ushort *t, int n) {
+    PatternMasks masks(p, m);
+    quint64 last = quint64(1) << ((m - 1) % 64);
+    quint64 eq, x, d0, hp, hn;
+    uint distance = m;
+
+    if(masks.blocks == 1) {
+        quint64 vp = ~quint64(0), vn = 0;
+        for(int j=0; j < n; ++j) {
+            eq = masks.get(0, t[j]);
+            x = eq | vn;
+            d0 = (((x & vp) + vp) ^ vp) | x;
+            hp = vn | ~(d0 | vp);
+            hn = d0 & vp;
+            if(hp & last)
+                ++distance;
+            if(hn & last)
+                --distance;
+            hp = (hp << 1) | 1;
+            hn = hn << 1;
+            vp = hn | ~(d0 | hp);
+            vn = hp & d0;
+        }
+        return distance;
+    }
+
+    int blocks = masks.blocks;
+    QVector<quint64> vp(blocks, ~quint64(0)), vn(blocks, 0);
+    quint64 hpIn, hnIn, hpOut, hnOut;
+    for(int j=0; j < n; ++j) {
+        // The first row of the matrix always increases by one
+        hpOut = 1;
+        hnOut = 0;
+        for(int b=0; b < blocks; ++b) {
+            eq = masks.get(b, t[j]);
+            hpIn = hpOut;
+            hnIn = hnOut;
+            x = eq | hnIn;
+            d0 = (((x & vp[b]) + vp[b]) ^ vp[b]) | x | vn[b];
+            hp = vn[b] | ~(d0 | vp[b]);
+            hn = d0 & vp[b];
+            if(b < blocks - 1) {
+                hpOut = hp >> 63;
+                hnOut = hn >> 63;
+            } else {
+                hpOut = (hp & last) ? 1 : 0;
+                hnOut = (hn & last) ? 1 : 0;
+            }
+            hp = (hp << 1) | hpIn;
+            hn = (hn << 1) | hnIn;
+            vp[b] = hn | ~(d0 | hp);
+            vn[b] = hp & d0;
+        }
+        distance += hpOut;
+        distance -= hnOut;
+    }
+    return distance;
+}
+
+uint levenshtein(const QString &s1, const QString &s2) {
+    const ushort *a = s1.utf16(), *b = s2.utf16();
+    int n1 = s1.size(), n2 = s2.size();
+
+    // The common prefix and suffix do not change the distance
+    while(n1 > 0 && n2 > 0 && *a == *b) {
+        ++a;
+        ++b;
+        --n1;
+        --n2;
     }
-    return prevCol[len2];
+    while(n1 > 0 && n2 > 0 && a[n1-1] == b[n2-1]) {
+        --n1;
+        --n2;
+    }
+    if(n1 == 0 || n2 == 0)
+        return n1 + n2;
+
+    // The shortest string is the pattern, so that it spans as few blocks as possible
+    return (n1 <= n2) ? myers(a, n1, b, n2) : myers(b, n2, a, n1);
+}
+
+static QReadWriteLock levenshteinLock;
+static QHash<quint64, uint> levenshteinCache;
+
+uint levenshtein(int s1, int s2) {
+    if(s1 == s2)
+        return 0;
+    // The distance is symmetric
+    quint64 key = (s1 < s2) ? ((quint64(s1) << 32) | uint(s2)) : ((quint64(s2) << 32) | uint(s1));
+
+    levenshteinLock.lockForRead();
+    QHash<quint64, uint>::const_iterator it = levenshteinCache.constFind(key);
+    bool found = (it != levenshteinCache.constEnd());
+    uint distance = found ? it.value() : 0;
+    levenshteinLock.unlock();
+    if(found)
+        return distance;
+
+    distance = levenshtein(StringPool::get(s1), StringPool::get(s2));
+    levenshteinLock.lockForWrite();
+    if(levenshteinCache.size() < GEMPP_LEVENSHTEIN_CACHE)
+        levenshteinCache.insert(key, distance);
+    levenshteinLock.unlock();
+    return distance;
 }
@@ -1,9 +1,11 @@
 #ifndef GEMPP_WEIGHTS_H
 #define GEMPP_WEIGHTS_H
 
+#include <QCryptographicHash>
 #include <QStringList>
 #include <qmath.h>
 #include "GraphElement.h"
+#include "CostProgram.h"
 #include "WeightHash.h"
 #include "Core/IXmlSerializable.h"
 
@@ -15,6 +17,8 @@
 #define GEMPP_DEFAULT_C_ATTR 0.0
 #define GEMPP_DEFAULT_C_POWER 1
 
+#define GEMPP_LEVENSHTEIN_CACHE (1 << 22)
+
 class DLL_EXPORT Weights : virtual public IXmlSerializable {
         friend class QConfigurationDialog;
     public:
@@ -34,6 +38,17 @@ class DLL_EXPORT Weights : virtual public IXmlSerializable {
         bool hasWeight(Operation op, GraphElement::Type t, QString attribute) const;
         Weight* getWeight(Operation op, GraphElement::Type t, QString attribute) const;
         Weight* getWeightOrDefault(Operation op, GraphElement::Type t, QString attribute, QMetaType::Type attributeType = QMetaType::Double);
+
+        /**
+         * @brief Returns the weight of an attribute, or its default weight, without adding it to the weights.
+         * It is used by the cost computations, which may run in several threads at once.
+         * @param op the operation
+         * @param t the type of element
+         * @param attribute the name of the attribute
+         * @param attributeType the type of the attribute
+         * @return the weight, which must not be modified
+         */
+        const Weight *findWeight(Operation op, GraphElement::Type t, const QString &attribute, QMetaType::Type attributeType = QMetaType::Double) const;
         void addWeight(Operation op, GraphElement::Type t, QString attribute, Weight::Type type, uint power, double value);
 
         double getDefaultWeight(Operation op) const;
@@ -46,8 +61,26 @@ class DLL_EXPORT Weights : virtual public IXmlSerializable {
         double creationCost(GraphElement *e);
         double substitutionCost(GraphElement *e1, GraphElement *e2);
 
+        /**
+         * @brief Compiles the substitution weights of the columns of an attribute schema into an immutable
+         * program, adding the default weights of the unknown attributes. The program does not follow the
+         * later changes of the weights.
+         * @param schema the schema
+         * @param t the type of the elements described by the schema
+         * @return the program
+         */
+        CostProgram compile(const AttributeSchema *schema, GraphElement::Type t);
+
         WeightHash *getWeights(Operation op, GraphElement::Type t) const;
 
+        /**
+         * @brief Computes a hash of the weights, their modes and roots, and the default weights.
+         * The default weights of the attributes met while computing costs are added to the weights,
+         * so the hash of the weights as loaded must be computed before computing any cost.
+         * @return the SHA-1 hash
+         */
+        QByteArray getHash() const;
+
         void load(const QString &filename, Operation op);
         void load(const QDomElement &root, Operation op);
         void save(const QString &filename, Operation op);
@@ -66,6 +99,22 @@ class DLL_EXPORT Weights : virtual public IXmlSerializable {
 
 void operator*=(Weights &w, double d);
 void operator+=(Weights &w1, Weights w2);
-uint levenshtein(QString s1, QString s2);
+
+/**
+ * @brief Computes the edit distance between two strings, with a bit-parallel algorithm.
+ * @param s1 the first string
+ * @param s2 the second string
+ * @return the distance
+ */
+uint levenshtein(const QString &s1, const QString &s2);
+
+/**
+ * @brief Computes the edit distance between two interned strings. The distances are cached
+ * for the whole run, up to GEMPP_LEVENSHTEIN_CACHE pairs of strings.
+ * @param s1 the identifier of the first string in the ::StringPool
+ * @param s2 the identifier of the second string in the ::StringPool
+ * @return the distance
+ */
+uint levenshtein(int s1, int s2);
 
 #endif /* GEMPP_WEIGHTS_H*/
@@ -9,6 +9,8 @@ Configuration::~Configuration() {}
 void Configuration::clean() {
     substitution = "";
     creation = "";
+    costs = "";
+    cacheSize = 0;
     outputDir = "";
     program = "";
     solution = "";
@@ -17,6 +19,7 @@ void Configuration::clean() {
     ext = "";
 
     verbose = false;
+    dedup = false;
     cutMethod = Formulation::SOLUTION;
     number = 1;
 
@@ -24,6 +27,9 @@ void Configuration::clean() {
     subMethod = SubgraphMatching::TOPOLOGY;
     induced = false;
     gedMethod = GraphEditDistance::LINEAR;
+    bipartiteStart = false;
+    symmetry = false;
+    branching = false;
 
     upperbound = 1.0;
 
@@ -31,6 +37,7 @@ void Configuration::clean() {
     parallelInstances = 1;
 
     timeLimit = INFINITY; // seconds
+    deadline = INFINITY; // seconds, for all the matchings
 }
 
 void Configuration::print(Printer *p) {
@@ -39,6 +46,8 @@ void Configuration::print(Printer *p) {
 
     p->dump("substitution : "+substitution);
     p->dump("creation : "+creation);
+    p->dump("costs : "+costs);
+    p->dump(QString("cacheSize : %1").arg(cacheSize));
     p->dump("outputDir : "+outputDir);
     p->dump("program : "+program);
     p->dump("solution : "+solution);
@@ -47,6 +56,7 @@ void Configuration::print(Printer *p) {
     p->dump("ext : "+ext);
 
     p->dump(QString("verbose : %1").arg(verbose));
+    p->dump(QString("dedup : %1").arg(dedup));
     p->dump(QString("number : %1").arg(number));
     p->dump("cutMethod : "+Formulation::toName(cutMethod));
 
@@ -54,6 +64,7 @@ void Configuration::print(Printer *p) {
     switch(matchingType) {
         case Problem::GED:
             p->dump("gedMethod : "+GraphEditDistance::toName(gedMethod));
+            p->dump(QString("bipartiteStart : %1").arg(bipartiteStart));
             break;
         case Problem::SUBGRAPH:
             p->dump("subMethod : "+SubgraphMatching::toName(subMethod));
@@ -63,6 +74,8 @@ void Configuration::print(Printer *p) {
             break;
     }
 
+    p->dump(QString("symmetry : %1").arg(symmetry));
+    p->dump(QString("branching : %1").arg(branching));
     p->dump(QString("upperbound : %1").arg(upperbound));
     p->unindent();
     p->dump("}");
@@ -72,5 +85,9 @@ bool Configuration::check() {
     if((matchingType == Problem::SUBGRAPH) && (upperbound < 1.0) && (subMethod == SubgraphMatching::EXACT))
         Exception("GEM++ forbids upper-bound approximation with subgraph isomorphism.\n"
                                "Please use substitution or error tolerant form instead.");
+    // The orbits are computed from the attributes, which do not determine the costs read from a file
+    if(symmetry && !costs.isEmpty())
+        Exception("GEM++ forbids symmetry breaking with precomputed costs.\n"
+                  "The symmetries of the attributes may not hold for the costs, and the optimum could be cut off.");
     return true;
 }
@@ -17,6 +17,7 @@ class DLL_EXPORT Configuration : virtual public IPrintable, virtual public IClea
 
         QString substitution;
         QString creation;
+        QString costs;
         QString outputDir;
         QString program;
         QString solution;
@@ -25,13 +26,18 @@ class DLL_EXPORT Configuration : virtual public IPrintable, virtual public IClea
         QString ext;
 
         bool verbose;
+        bool dedup;
         int number;
+        int cacheSize;
         Formulation::CutMethod cutMethod;
 
         Problem::Type matchingType;
         SubgraphMatching::Method subMethod;
         bool induced;
         GraphEditDistance::Method gedMethod;
+        bool bipartiteStart;
+        bool symmetry;
+        bool branching;
 
         double upperbound;
 
@@ -39,6 +45,7 @@ class DLL_EXPORT Configuration : virtual public IPrintable, virtual public IClea
         int parallelInstances;
 
         double timeLimit;
+        double deadline;
 };
 
 #endif /* GEMPP_CONFIGURATION_H */
@@ -0,0 +1,400 @@
+#include "LagrangianRelaxation.h"
+#include <algorithm>
+
+LagrangianRelaxation::LagrangianRelaxation(Problem *pb, SubgraphMatching::Method method, double up, bool induced, int maxIterations) :
+    pb_(pb), method_(method), induced_(induced), maxIterations_(maxIterations), big_(0), constant_(0),
+    lowerBound_(-INFINITY), upperBound_(INFINITY), infeasible_(false) {
+    if(method_ != SubgraphMatching::LABEL && method_ != SubgraphMatching::TOPOLOGY)
+        Exception("The Lagrangian relaxation only handles substitution-tolerant and error-tolerant subgraph matching.");
+
+    Graph *query = pb_->getQuery();
+    Graph *target = pb_->getTarget();
+    nVP = query->getVertexCount();
+    nVT = target->getVertexCount();
+    nEP = query->getEdgeCount();
+    nET = target->getEdgeCount();
+    isDirected = (query->getType() == Graph::DIRECTED);
+
+    // Edge extremities
+    int i, j, k, l, ij, kl;
+    qOrigins_ = QVector<int>(nEP);
+    qTargets_ = QVector<int>(nEP);
+    for(ij=0; ij < nEP; ++ij) {
+        i = qOrigins_[ij] = query->getEdge(ij)->getOrigin()->getIndex();
+        j = qTargets_[ij] = query->getEdge(ij)->getTarget()->getIndex();
+        qEdges_[qMakePair(i, j)].append(ij);
+        if(!isDirected && i != j)
+            qEdges_[qMakePair(j, i)].append(ij);
+    }
+    tOrigins_ = QVector<int>(nET);
+    tTargets_ = QVector<int>(nET);
+    for(kl=0; kl < nET; ++kl) {
+        k = tOrigins_[kl] = target->getEdge(kl)->getOrigin()->getIndex();
+        l = tTargets_[kl] = target->getEdge(kl)->getTarget()->getIndex();
+        tEdges_[qMakePair(k, l)].append(kl);
+        if(!isDirected && k != l)
+            tEdges_[qMakePair(l, k)].append(kl);
+    }
+
+    // Costs, as in the formulations
+    bool mcsm = (method_ == SubgraphMatching::TOPOLOGY);
+    x_costs = QVector<double>(nVP*nVT);
+    for(i=0; i < nVP; ++i)
+        for(k=0; k < nVT; ++k)
+            x_costs[i*nVT + k] = pb_->getCost(GraphElement::VERTEX, i, k) - (mcsm ? query->getVertex(i)->getCost() : 0);
+    restrictProblem(up);
+    if(mcsm) {
+        for(i=0; i < nVP; ++i)
+            constant_ += query->getVertex(i)->getCost();
+        for(ij=0; ij < nEP; ++ij)
+            constant_ += query->getEdge(ij)->getCost();
+    }
+
+    lambdaA_ = QVector<double>(nEP*nVT, 0);
+    lambdaB_ = QVector<double>(nEP*nVT, 0);
+    mu_ = QVector<double>(nET, 0);
+    bestX_ = QVector<int>(nVP, -1);
+    bestY_ = QVector<int>(nEP, -1);
+
+    // Substitution-tolerant matching requires every query element to be substituted
+    infeasible_ = !mcsm && (nVP > nVT);
+    for(ij=0; ij < nEP && !infeasible_; ++ij)
+        infeasible_ = !mcsm && (y_starts[ij] == y_starts[ij+1]);
+}
+
+LagrangianRelaxation::~LagrangianRelaxation() {}
+
+double LagrangianRelaxation::solve(double timeLimit) {
+    QElapsedTimer timer;
+    timer.start();
+    lowerBound_ = -INFINITY;
+    upperBound_ = INFINITY;
+    bestX_.fill(-1);
+    bestY_.fill(-1);
+    lambdaA_.fill(0);
+    lambdaB_.fill(0);
+    mu_.fill(0);
+    if(infeasible_) {
+        lowerBound_ = INFINITY;
+        return upperBound_;
+    }
+
+    QVector<int> x, y;
+    double value, theta = 2.0;
+    int stall = 0;
+    for(int it=0; it < maxIterations_; ++it) {
+        if(pb_->isCancelled() || timer.elapsed() > timeLimit*1000)
+            break;
+
+        // Lower bound, the step factor is halved when it stalls
+        value = solveRelaxation(x, y);
+        if(value > lowerBound_ + precision) {
+            lowerBound_ = value;
+            stall = 0;
+        } else if(++stall >= 20) {
+            theta /= 2;
+            stall = 0;
+        }
+
+        // Upper bound
+        repair(x);
+
+        if(getStatus() == Solution::OPTIMAL || theta < 1e-4 || !step(x, y, value, theta))
+            break;
+    }
+    return upperBound_;
+}
+
+double LagrangianRelaxation::getLowerBound() const {
+    return lowerBound_;
+}
+
+double LagrangianRelaxation::getUpperBound() const {
+    return upperBound_;
+}
+
+Solution::Status LagrangianRelaxation::getStatus() const {
+    if(upperBound_ < INFINITY)
+        return (upperBound_ - lowerBound_ <= precision * qMax(1.0, fabs(upperBound_))) ? Solution::OPTIMAL : Solution::SUBOPTIMAL;
+    if(infeasible_)
+        return Solution::INFEASIBLE;
+    return Solution::NOT_SOLVED;
+}
+
+const QVector<int> &LagrangianRelaxation::getVertexMatching() const {
+    return bestX_;
+}
+
+const QVector<int> &LagrangianRelaxation::getEdgeMatching() const {
+    return bestY_;
+}
+
+void LagrangianRelaxation::fill(Solution *sol, Program *program) const {
+    sol->clean();
+    sol->setStatus(getStatus());
+    if(sol->isValid()) {
+        for(int i=0; i < nVP; ++i)
+            if(bestX_[i] >= 0)
+                sol->addVariable(program->getVariable(QString("x_%1,%2").arg(i).arg(bestX_[i])), 1);
+        for(int ij=0; ij < nEP; ++ij)
+            if(bestY_[ij] >= 0)
+                sol->addVariable(program->getVariable(QString("y_%1,%2").arg(ij).arg(bestY_[ij])), 1);
+    }
+    sol->setObjective(upperBound_);
+    sol->setBound(lowerBound_);
+}
+
+void LagrangianRelaxation::restrictProblem(double up) {
+    int i, j, k, l, ij, kl;
+    x_active = QVector<bool>(nVP*nVT, true);
+    if(up < 1) {
+        QVector<double> v;
+        for(i=0; i < nVP; ++i) {
+            v = x_costs.mid(i*nVT, nVT);
+            std::sort(v.begin(), v.end());
+            for(k=0; k < nVT; ++k)
+                if(x_costs[i*nVT + k] > v[floor(nVT * up)])
+                    x_active[i*nVT + k] = false;
+        }
+
+        v = QVector<double>(nVP);
+        for(k=0; k < nVT; ++k) {
+            for(i=0; i < nVP; ++i)
+                v[i] = x_costs[i*nVT + k];
+            std::sort(v.begin(), v.end());
+            for(i=0; i < nVP; ++i)
+                if(x_costs[i*nVT + k] > v[floor(nVP * up)])
+                    x_active[i*nVT + k] = false;
+        }
+    }
+    for(i=0; i < nVP*nVT; ++i)
+        big_ += fabs(x_costs[i]);
+    big_ += 1;
+
+    // The costs of the edge substitutions are only evaluated for the pairs which remain
+    bool mcsm = (method_ == SubgraphMatching::TOPOLOGY);
+    y_starts = QVector<int>(nEP+1, 0);
+    y_edges.clear();
+    y_costs.clear();
+    for(ij=0; ij < nEP; ++ij) {
+        i = qOrigins_[ij];
+        j = qTargets_[ij];
+        for(kl=0; kl < nET; ++kl) {
+            k = tOrigins_[kl];
+            l = tTargets_[kl];
+            if(!(x_active[i*nVT + k] && x_active[j*nVT + l]) &&
+               (isDirected || !(x_active[i*nVT + l] && x_active[j*nVT + k])))
+                continue;
+            y_edges.append(kl);
+            y_costs.append(pb_->getCost(GraphElement::EDGE, ij, kl) - (mcsm ? pb_->getQuery()->getEdge(ij)->getCost() : 0));
+        }
+        y_starts[ij+1] = y_edges.size();
+    }
+}
+
+double LagrangianRelaxation::getEdgeCost(int ij, int kl) const {
+    const int *begin = y_edges.constData() + y_starts[ij];
+    const int *end = y_edges.constData() + y_starts[ij+1];
+    const int *it = std::lower_bound(begin, end, kl);
+    if(it == end || *it != kl)
+        Exception(QString("The substitution of the edges %1 and %2 has not been kept").arg(ij).arg(kl));
+    return y_costs[it - y_edges.constData()];
+}
+
+double LagrangianRelaxation::solveRelaxation(QVector<int> &x, QVector<int> &y) {
+    int i, k, o, t, ij, kl, n;
+    double la, lb, r, best;
+    double value = constant_;
+
+    // Reduced vertex substitution costs, the ones which are not kept are avoided
+    QVector<double> rx = x_costs;
+    for(i=0; i < nVP*nVT; ++i)
+        if(!x_active[i])
+            rx[i] += big_;
+    for(ij=0; ij < nEP; ++ij) {
+        o = qOrigins_[ij];
+        t = qTargets_[ij];
+        for(k=0; k < nVT; ++k) {
+            la = lambdaA_[ij*nVT + k];
+            lb = lambdaB_[ij*nVT + k];
+            if(isDirected) {
+                rx[o*nVT + k] -= la;
+                rx[t*nVT + k] -= lb;
+            } else {
+                rx[o*nVT + k] -= la + lb;
+                rx[t*nVT + k] -= la + lb;
+            }
+        }
+    }
+    if(induced_) {
+        for(kl=0; kl < nET; ++kl) {
+            for(i=0; i < nVP; ++i) {
+                rx[i*nVT + tOrigins_[kl]] += mu_[kl];
+                rx[i*nVT + tTargets_[kl]] += mu_[kl];
+            }
+            value -= mu_[kl];
+        }
+    }
+
+    // Vertex assignment
+    x = Assignment::solve(rx, nVP, nVT, method_ == SubgraphMatching::TOPOLOGY);
+    value += Assignment::cost(rx, nVT, x);
+
+    // Best target edge for each query edge
+    y = QVector<int>(nEP, -1);
+    for(ij=0; ij < nEP; ++ij) {
+        best = (method_ == SubgraphMatching::TOPOLOGY) ? 0 : INFINITY;
+        for(n=y_starts[ij]; n < y_starts[ij+1]; ++n) {
+            kl = y_edges[n];
+            r = y_costs[n] + lambdaA_[ij*nVT + tOrigins_[kl]] + lambdaB_[ij*nVT + tTargets_[kl]];
+            if(induced_)
+                r -= mu_[kl];
+            if(r < best) {
+                best = r;
+                y[ij] = kl;
+            }
+        }
+        if(y[ij] >= 0)
+            value += best;
+    }
+    return value;
+}
+
+void LagrangianRelaxation::repair(QVector<int> x) {
+    QVector<int> y, pre;
+    QVector<bool> covered;
+    int i, o, t, ij, kl;
+    bool feasible = false;
+    // The substitutions which are not kept are given up, which only error-tolerant matching allows
+    for(i=0; i < nVP; ++i) {
+        if(x[i] >= 0 && !x_active[i*nVT + x[i]]) {
+            if(method_ == SubgraphMatching::LABEL)
+                return;
+            x[i] = -1;
+        }
+    }
+    while(!feasible) {
+        // Substitutes each query edge to the cheapest target edge between the images of its extremities
+        y = QVector<int>(nEP, -1);
+        for(ij=0; ij < nEP; ++ij) {
+            o = qOrigins_[ij];
+            t = qTargets_[ij];
+            if(x[o] >= 0 && x[t] >= 0)
+                for(int kl : tEdges_.value(qMakePair(x[o], x[t])))
+                    if(y[ij] < 0 || getEdgeCost(ij, kl) < getEdgeCost(ij, y[ij]))
+                        y[ij] = kl;
+            if(method_ == SubgraphMatching::TOPOLOGY && y[ij] >= 0 && getEdgeCost(ij, y[ij]) >= 0)
+                y[ij] = -1;
+            // The topology of the query is not preserved
+            if(method_ == SubgraphMatching::LABEL && y[ij] < 0)
+                return;
+        }
+
+        // Every target edge between two images must be substituted
+        feasible = true;
+        if(induced_) {
+            pre = QVector<int>(nVT, -1);
+            for(i=0; i < nVP; ++i)
+                if(x[i] >= 0)
+                    pre[x[i]] = i;
+            covered = QVector<bool>(nET, false);
+            for(ij=0; ij < nEP; ++ij)
+                if(y[ij] >= 0)
+                    covered[y[ij]] = true;
+            for(kl=0; kl < nET && feasible; ++kl) {
+                o = pre[tOrigins_[kl]];
+                t = pre[tTargets_[kl]];
+                if(covered[kl] || o < 0 || t < 0)
+                    continue;
+                for(int ij : qEdges_.value(qMakePair(o, t))) {
+                    if(y[ij] < 0) {
+                        y[ij] = kl;
+                        covered[kl] = true;
+                        break;
+                    }
+                }
+                if(covered[kl])
+                    continue;
+                if(method_ == SubgraphMatching::LABEL)
+                    return;
+                // Error-tolerant matching : gives up one of the vertex substitutions and retries
+                x[t] = -1;
+                feasible = false;
+            }
+        }
+    }
+
+    double value = constant_;
+    for(i=0; i < nVP; ++i)
+        if(x[i] >= 0)
+            value += x_costs[i*nVT + x[i]];
+    for(ij=0; ij < nEP; ++ij)
+        if(y[ij] >= 0)
+            value += getEdgeCost(ij, y[ij]);
+    if(value < upperBound_) {
+        upperBound_ = value;
+        bestX_ = x;
+        bestY_ = y;
+    }
+}
+
+bool LagrangianRelaxation::step(const QVector<int> &x, const QVector<int> &y, double value, double theta) {
+    int o, t, ij, kl;
+
+    // Subgradients, i.e. the slacks of the relaxed constraints
+    QVector<double> gA(nEP*nVT, 0), gB(nEP*nVT, 0), gM(induced_ ? nET : 0, 0);
+    for(ij=0; ij < nEP; ++ij) {
+        o = qOrigins_[ij];
+        t = qTargets_[ij];
+        if(y[ij] >= 0) {
+            gA[ij*nVT + tOrigins_[y[ij]]] += 1;
+            gB[ij*nVT + tTargets_[y[ij]]] += 1;
+        }
+        if(x[o] >= 0) {
+            gA[ij*nVT + x[o]] -= 1;
+            if(!isDirected)
+                gB[ij*nVT + x[o]] -= 1;
+        }
+        if(x[t] >= 0) {
+            gB[ij*nVT + x[t]] -= 1;
+            if(!isDirected)
+                gA[ij*nVT + x[t]] -= 1;
+        }
+    }
+    if(induced_) {
+        QVector<int> matched(nVT, 0);
+        for(int i=0; i < nVP; ++i)
+            if(x[i] >= 0)
+                matched[x[i]] = 1;
+        for(kl=0; kl < nET; ++kl)
+            gM[kl] = matched[tOrigins_[kl]] + matched[tTargets_[kl]] - 1;
+        for(ij=0; ij < nEP; ++ij)
+            if(y[ij] >= 0)
+                gM[y[ij]] -= 1;
+    }
+
+    // Norm of the projected subgradient
+    double norm = 0;
+    for(int n=0; n < nEP*nVT; ++n) {
+        if(lambdaA_[n] > 0 || gA[n] > 0)
+            norm += gA[n]*gA[n];
+        if(lambdaB_[n] > 0 || gB[n] > 0)
+            norm += gB[n]*gB[n];
+    }
+    for(kl=0; kl < gM.size(); ++kl)
+        if(mu_[kl] > 0 || gM[kl] > 0)
+            norm += gM[kl]*gM[kl];
+    if(norm == 0)
+        return false;
+
+    // Polyak step towards the best known objective
+    double target = (upperBound_ < INFINITY) ? upperBound_ : value + 0.1 * qMax(1.0, fabs(value));
+    double s = theta * qMax(target - value, 0.0) / norm;
+    for(int n=0; n < nEP*nVT; ++n) {
+        lambdaA_[n] = qMax(0.0, lambdaA_[n] + s * gA[n]);
+        lambdaB_[n] = qMax(0.0, lambdaB_[n] + s * gB[n]);
+    }
+    for(kl=0; kl < gM.size(); ++kl)
+        mu_[kl] = qMax(0.0, mu_[kl] + s * gM[kl]);
+    return true;
+}
@@ -0,0 +1,198 @@
+#ifndef GEMPP_LAGRANGIANRELAXATION_H
+#define GEMPP_LAGRANGIANRELAXATION_H
+
+#include <QElapsedTimer>
+#include "Core/Assignment.h"
+#include "Formulation/SubgraphMatching.h"
+#include "Formulation/Solution.h"
+
+/**
+ * @brief The LagrangianRelaxation class solves the substitution-tolerant and the
+ * error-tolerant subgraph matching problems without any solver plugin, using the
+ * costs of the ::Problem.
+ *
+ * The (F2) constraints that couple the edge substitutions to the vertex substitutions
+ * (as well as the induced constraints) are relaxed with non-negative multipliers. The
+ * relaxed problem decomposes into an assignment problem on the vertices, solved with
+ * ::Assignment, and an independent choice for each query edge. Its optimal value is a
+ * lower bound of the problem, which is maximized by a projected subgradient method.
+ * At each iteration, the vertex assignment is repaired into a feasible solution,
+ * which gives an upper bound.
+ *
+ * The best feasible solution is optimal when both bounds meet, otherwise it is
+ * suboptimal and its gap to the lower bound is certified.
+ *
+ * As in the formulations, the vertex substitutions can be restricted to the cheapest
+ * ones. Only the edge substitutions whose extremities remain possible are kept, and
+ * their costs are evaluated once.
+ *
+ * @author J.Lerouge <julien.lerouge@litislab.fr>
+ * @see SubstitutionTolerantSubgraphMatching, MinimumCostSubgraphMatching
+ */
+class DLL_EXPORT LagrangianRelaxation {
+    public:
+        /**
+         * @brief Constructs a new LagrangianRelaxation object.
+         * @param pb the subgraph matching problem, whose costs have been computed
+         * @param method the level of tolerance (SubgraphMatching::LABEL or SubgraphMatching::TOPOLOGY)
+         * @param up the upper bound (between 0 and 1) of the exploration of the vertex substitutions
+         * @param induced controls the use of induced matching
+         * @param maxIterations the maximal number of subgradient iterations
+         */
+        LagrangianRelaxation(Problem *pb, SubgraphMatching::Method method, double up = 1.0, bool induced = false, int maxIterations = 1000);
+
+        /**
+         * @brief Destructs a LagrangianRelaxation object.
+         */
+        virtual ~LagrangianRelaxation();
+
+        /**
+         * @brief Runs the subgradient method, until both bounds meet, the iterations are exhausted,
+         * the time limit is reached or the problem is cancelled.
+         * @param timeLimit the time limit in seconds
+         * @return the objective of the best feasible solution, INFINITY if none has been found
+         */
+        double solve(double timeLimit = INFINITY);
+
+        /**
+         * @brief Returns the best lower bound.
+         * @return the lower bound
+         */
+        double getLowerBound() const;
+
+        /**
+         * @brief Returns the objective of the best feasible solution.
+         * @return the upper bound, INFINITY if no feasible solution has been found
+         */
+        double getUpperBound() const;
+
+        /**
+         * @brief Returns the status of the best feasible solution.
+         * @return the status
+         */
+        Solution::Status getStatus() const;
+
+        /**
+         * @brief Returns the vertex substitutions of the best feasible solution.
+         * @return the target vertex of each query vertex, -1 if it is not substituted
+         */
+        const QVector<int> &getVertexMatching() const;
+
+        /**
+         * @brief Returns the edge substitutions of the best feasible solution.
+         * @return the target edge of each query edge, -1 if it is not substituted
+         */
+        const QVector<int> &getEdgeMatching() const;
+
+        /**
+         * @brief Fills a solution of a formulation with the best feasible solution.
+         * @param sol the solution to fill
+         * @param program the program of the formulation, which contains the x and y variables
+         */
+        void fill(Solution *sol, Program *program) const;
+
+    private:
+        Problem *pb_;
+        SubgraphMatching::Method method_;
+        bool induced_;
+        int maxIterations_;
+
+        int nVP, nVT, nEP, nET;
+        bool isDirected;
+
+        /**
+         * @brief The extremities of the query and target edges.
+         */
+        QVector<int> qOrigins_, qTargets_, tOrigins_, tTargets_;
+
+        /**
+         * @brief The target edges (resp. query edges) that link two vertices, in the direction of the edge.
+         * Undirected edges are stored in both directions.
+         */
+        QHash< QPair<int, int>, QList<int> > tEdges_, qEdges_;
+
+        /**
+         * @brief The vertex substitution costs of the formulation, in row-major order.
+         */
+        QVector<double> x_costs;
+
+        /**
+         * @brief Whether each vertex substitution is kept by the restriction, in row-major order.
+         */
+        QVector<bool> x_active;
+
+        /**
+         * @brief The cost added to the vertex substitutions which are not kept,
+         * so that the relaxed problem avoids them.
+         */
+        double big_;
+
+        /**
+         * @brief The kept edge substitutions, row by row : the target edges of the query edge ij,
+         * in increasing order, and their costs are stored from y_starts[ij] to y_starts[ij+1].
+         */
+        QVector<int> y_starts, y_edges;
+        QVector<double> y_costs;
+
+        /**
+         * @brief The constant part of the objective.
+         */
+        double constant_;
+
+        /**
+         * @brief The multipliers of the (F2) constraints on the out-edges (a) and on the in-edges (b)
+         * of the target vertices, in row-major order (query edge, target vertex).
+         */
+        QVector<double> lambdaA_, lambdaB_;
+
+        /**
+         * @brief The multipliers of the induced constraints, one for each target edge.
+         */
+        QVector<double> mu_;
+
+        double lowerBound_;
+        double upperBound_;
+        QVector<int> bestX_, bestY_;
+        bool infeasible_;
+
+        /**
+         * @brief Restricts the vertex substitutions, then keeps the edge substitutions
+         * whose extremities remain possible and evaluates their costs.
+         * @param up the upper bound (between 0 and 1) of the exploration
+         */
+        void restrictProblem(double up);
+
+        /**
+         * @brief Returns the cost of a kept edge substitution.
+         * @param ij the index of the edge of the query graph
+         * @param kl the index of the edge of the target graph
+         * @return the cost
+         */
+        double getEdgeCost(int ij, int kl) const;
+
+        /**
+         * @brief Solves the relaxed problem for the current multipliers.
+         * @param x the resulting vertex substitutions
+         * @param y the resulting edge substitutions
+         * @return the value of the relaxed problem (a lower bound)
+         */
+        double solveRelaxation(QVector<int> &x, QVector<int> &y);
+
+        /**
+         * @brief Repairs a vertex assignment into a feasible solution, and keeps it if it is the best one.
+         * @param x the vertex substitutions
+         */
+        void repair(QVector<int> x);
+
+        /**
+         * @brief Updates the multipliers along the subgradient of the relaxation.
+         * @param x the vertex substitutions of the relaxed problem
+         * @param y the edge substitutions of the relaxed problem
+         * @param value the value of the relaxed problem
+         * @param theta the step factor
+         * @return false if the subgradient is zero, i.e. the relaxed solution is optimal
+         */
+        bool step(const QVector<int> &x, const QVector<int> &y, double value, double theta);
+};
+
+#endif /* GEMPP_LAGRANGIANRELAXATION_H */
@@ -38,7 +38,8 @@ Configuration *Matcher::getConfiguration() {
 void Matcher::setConfiguration(Configuration *cfg) {
     clean();
     cfg_ = cfg;
-    if(cfg)
+    // The Lagrangian relaxation does not need any solver plugin
+    if(cfg && Solver::fromName(cfg->solver) != Solver::LAGRANGIAN)
         s_ = PluginLoader().loadSolver(Solver::fromName(cfg->solver));
 }
 
@@ -61,10 +62,18 @@ void Matcher::run() {
         Exception("The matcher needs a problem to solve before running the matching algorithm.");
     if(!cfg_)
         Exception("The matcher needs a configuration to run the matching algorithm.");
+    if(Solver::fromName(cfg_->solver) == Solver::LAGRANGIAN) {
+        cfg_->matchingType = pb_->getType();
+        cfg_->check();
+        runLagrangian();
+        emit finished(pb_, obj_);
+        return;
+    }
     if(!s_)
         Exception("The matcher has failed initializing a solver, thus it can't run the matching algorithm.");
     cfg_->matchingType = pb_->getType();
     cfg_->check();
+    s_->setCancellationToken(pb_->getCancellationToken());
 
     // Variables declaration
     GraphEditDistance *ged = 0;
@@ -109,7 +118,16 @@ void Matcher::run() {
             break;
     }
 
-    if(f) {
+    // A cancelled problem is not solved, its objective remains infinite
+    if(f && !pb_->isCancelled()) {
+        if(cfg_->symmetry)
+            f->breakSymmetries();
+        if(cfg_->branching)
+            f->setBranchingHints();
+        // The cutoff of the start would discard the next solutions
+        if(cfg_->bipartiteStart && cfg_->number == 1 && ged && cfg_->gedMethod == GraphEditDistance::LINEAR)
+            ((LinearGraphEditDistance *) ged)->setBipartiteStart();
+
         switch(f->getProgram()->getType()) {
             case Program::LINEAR:
                 s_->init(f->getLinearProgram(), cfg_);
@@ -123,6 +141,11 @@ void Matcher::run() {
         sl->setFormulation(f);
         bool storeSolution = (cfg_->number > 1 || !cfg_->solution.isEmpty() || slout_);
 
+        // Interrupts the solver when the problem is cancelled
+        CancellationToken *token = pb_->getCancellationToken();
+        if(token)
+            connect(token, SIGNAL(cancelled()), this, SLOT(terminate()), Qt::DirectConnection);
+
         do {
             if(storeSolution)
                 sl->newSolution();
@@ -134,26 +157,17 @@ void Matcher::run() {
                 s_->update();
             }
 
-        } while (storeSolution && (sl->getSolutionCount() < cfg_->number) && sl->lastSolution()->isValid());
+        } while (storeSolution && (sl->getSolutionCount() < cfg_->number) && sl->lastSolution()->isValid() && !pb_->isCancelled());
+
+        if(token)
+            disconnect(token, SIGNAL(cancelled()), this, SLOT(terminate()));
 
         // Save solution to file
-        if(!cfg_->solution.isEmpty()) {
-            QString filename = cfg_->solution;
-            if(!QString::compare(filename, GEMPP_AUTO))
-                filename = QString("%1_%2.sol").arg(pb_->getQuery()->getID(), pb_->getTarget()->getID());
-            if(!cfg_->outputDir.isEmpty())
-                filename = cfg_->outputDir + "/" + filename;
-            sl->save(filename);
-        }
+        if(!cfg_->solution.isEmpty())
+            sl->save(getOutputFilename(cfg_->solution, "sol"));
         // Save program to file
-        if(!cfg_->program.isEmpty()) {
-            QString filename = cfg_->program;
-            if(!QString::compare(filename, GEMPP_AUTO))
-                filename = QString("%1_%2.lp").arg(pb_->getQuery()->getID(), pb_->getTarget()->getID());
-            if(!cfg_->outputDir.isEmpty())
-                filename = cfg_->outputDir + "/" + filename;
-            f->getProgram()->save(filename);
-        }
+        if(!cfg_->program.isEmpty())
+            f->getProgram()->save(getOutputFilename(cfg_->program, "lp"));
 
         // Retrieves the best objective (first solution)
         if(sl->getSolution(0))
@@ -165,28 +179,77 @@ void Matcher::run() {
         // If no output file is given, write to stdout
         //if(cfg_->matrix.isEmpty())
         //    qcout << obj_ << endl;
+    }
 
-        if(!slout_) {
-            switch(pb_->getType()) {
-                case Problem::GED:
-                    delete ged;
-                    break;
-                case Problem::SUBGRAPH:
-                    delete sm;
-                    break;
-                case Problem::NONE:
-                    break;
-                default:
-                    break;
-            }
-            if(sl)
-                delete sl;
+    // The formulation belongs to the output solution list once it has been solved
+    if(f && (!slout_ || !sl)) {
+        switch(pb_->getType()) {
+            case Problem::GED:
+                delete ged;
+                break;
+            case Problem::SUBGRAPH:
+                delete sm;
+                break;
+            case Problem::NONE:
+                break;
+            default:
+                break;
         }
+        if(sl)
+            delete sl;
     }
 
     emit finished(pb_, obj_);
 }
 
+void Matcher::runLagrangian() {
+    if(pb_->getType() != Problem::SUBGRAPH || (cfg_->subMethod != SubgraphMatching::LABEL && cfg_->subMethod != SubgraphMatching::TOPOLOGY))
+        Exception("The Lagrangian solver only handles substitution-tolerant and error-tolerant subgraph matching.");
+    if(cfg_->number > 1)
+        Exception("The Lagrangian solver computes a single solution, please use a solver plugin to enumerate several ones.");
+    if(pb_->isCancelled())
+        return;
+
+    double timeLimit = cfg_->timeLimit;
+    if(pb_->getCancellationToken())
+        timeLimit = qMin(timeLimit, pb_->getCancellationToken()->getRemainingTime());
+    LagrangianRelaxation lr(pb_, cfg_->subMethod, cfg_->upperbound, cfg_->induced);
+    obj_ = roundAtPrecision(lr.solve(timeLimit));
+
+    // The formulation is only built to express the solution with its variables
+    if(cfg_->solution.isEmpty() && !slout_)
+        return;
+    SubgraphMatching *sm;
+    if(cfg_->subMethod == SubgraphMatching::LABEL)
+        sm = new SubstitutionTolerantSubgraphMatching(pb_, cfg_->upperbound, cfg_->induced);
+    else
+        sm = new MinimumCostSubgraphMatching(pb_, cfg_->upperbound, cfg_->induced);
+    SolutionList *sl = slout_ ? slout_ : new SolutionList();
+    sl->setFormulation(sm);
+    sl->newSolution();
+    lr.fill(sl->lastSolution(), sm->getProgram());
+
+    if(!cfg_->solution.isEmpty())
+        sl->save(getOutputFilename(cfg_->solution, "sol"));
+    if(!cfg_->program.isEmpty())
+        sm->getProgram()->save(getOutputFilename(cfg_->program, "lp"));
+
+    // The formulation belongs to the output solution list
+    if(!slout_) {
+        delete sm;
+        delete sl;
+    }
+}
+
+QString Matcher::getOutputFilename(const QString &name, const QString &extension) {
+    QString filename = name;
+    if(!QString::compare(filename, GEMPP_AUTO))
+        filename = QString("%1_%2.%3").arg(pb_->getQuery()->getID(), pb_->getTarget()->getID(), extension);
+    if(!cfg_->outputDir.isEmpty())
+        filename = cfg_->outputDir + "/" + filename;
+    return filename;
+}
+
 void Matcher::initBipartiteCosts() {
     int nVP, nVT, i, k;
     nVP = pb_->getQuery()->getVertexCount();
@@ -194,6 +257,9 @@ void Matcher::initBipartiteCosts() {
 
     BipartiteEdges *bipe;
     for(i=0; i < nVP; ++i) {
+        // The formulation will not be solved anyway
+        if(pb_->isCancelled())
+            return;
         for(k=0; k < nVT; ++k) {
             bipe = new BipartiteEdges(pb_, i, k);
             s_->init(bipe->getLinearProgram());
@@ -201,15 +267,11 @@ void Matcher::initBipartiteCosts() {
             delete bipe;
         }
     }
-    Vertex *v;
-    for(i=0; i < nVP; ++i) {
-        v = pb_->getQuery()->getVertex(i);
-        for(auto e : v->getEdges(Vertex::EDGE_IN_OUT))
-            v->setCost(v->getCost()+e->getCost());
-    }
-    for(k=0; k < nVT; ++k) {
-        v = pb_->getTarget()->getVertex(k);
-        for(auto e : v->getEdges(Vertex::EDGE_IN_OUT))
-            v->setCost(v->getCost()+e->getCost());
-    }
+    // The costs of the incident edges are added to the creation costs by the formulation itself,
+    // since the graphs are shared by several problems
+}
+
+void Matcher::terminate() {
+    if(s_)
+        s_->terminate();
 }
@@ -12,6 +12,7 @@
 #include "Formulation/MCSM.h"
 #include "Formulation/SubgraphIsomorphism.h"
 #include "Formulation/SolutionList.h"
+#include "LagrangianRelaxation.h"
 
 class DLL_EXPORT Matcher : public QObject, virtual public QRunnable, virtual public ICleanable {
         Q_OBJECT
@@ -36,6 +37,9 @@ class DLL_EXPORT Matcher : public QObject, virtual public QRunnable, virtual pub
     signals:
         void finished(Problem *pb, double objective);
 
+    private slots:
+        void terminate();
+
     private:
         Problem *pb_;
         Configuration *cfg_;
@@ -43,6 +47,8 @@ class DLL_EXPORT Matcher : public QObject, virtual public QRunnable, virtual pub
         double obj_;
         SolutionList *slout_;
 
+        void runLagrangian();
+        QString getOutputFilename(const QString &name, const QString &extension);
         void initBipartiteCosts();
         void outputColGenIteration(int iteration, double limit);
         void outputRowGenIteration(int iteration, int generated, QPair<int, int> nb);
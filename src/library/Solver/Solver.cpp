@@ -3,14 +3,15 @@
 DLL_EXPORT const char* Solver::solverName[Solver::COUNT] = {
     "Cplex",
     "GLPK",
-    "Gurobi"
+    "Gurobi",
+    "Lagrangian"
 };
 
 Solver::Solvers Solver::fromName(QString name) {
     for(Solvers m = (Solvers)0; m < COUNT; m = (Solvers)((int)m + 1))
         if(QString(solverName[m]).startsWith(name, Qt::CaseInsensitive))
             return m;
-    Exception(QString("Solver '%1' not recognized, please use c(plex), gl(pk) or gu(robi).").arg(name));
+    Exception(QString("Solver '%1' not recognized, please use c(plex), gl(pk), gu(robi) or l(agrangian).").arg(name));
     return COUNT;
 }
 
@@ -18,12 +19,16 @@ QString Solver::toName(Solvers solver) {
     return solverName[(int)solver];
 }
 
+Solver::Solver() : lp_(0), qp_(0), cfg_(0), token_(0) {}
+
 void Solver::init(LinearProgram *lp, Configuration *cfg) {
     init(cfg);
     lp_ = lp;
     prepare();
     update(false);
     setObjective();
+    setBranching();
+    setStart();
 }
 
 void Solver::init(QuadProgram *qp, Configuration *cfg) {
@@ -32,6 +37,8 @@ void Solver::init(QuadProgram *qp, Configuration *cfg) {
     prepare();
     update(false);
     setObjective();
+    setBranching();
+    setStart();
 }
 
 void Solver::setLinearProgram(LinearProgram *lp) {
@@ -41,3 +48,26 @@ void Solver::setLinearProgram(LinearProgram *lp) {
 void Solver::setQuadProgram(QuadProgram *qp) {
     qp_ = qp;
 }
+
+void Solver::setCancellationToken(CancellationToken *token) {
+    token_ = token;
+}
+
+double Solver::getTimeLimit() const {
+    double timeLimit = cfg_ ? cfg_->timeLimit : INFINITY;
+    if(token_)
+        timeLimit = qMin(timeLimit, token_->getRemainingTime());
+    return timeLimit;
+}
+
+double Solver::useStart(Solution *sol, Solution::Status status) {
+    Program *p = lp_ ? (Program *)lp_ : (Program *)qp_;
+    if(sol) {
+        sol->clean();
+        sol->setStatus(status);
+        for(auto it = p->getStart().begin(); it != p->getStart().end(); ++it)
+            sol->addVariable(it.key(), it.value());
+        sol->setObjective(p->getStartObjective());
+    }
+    return p->getStartObjective();
+}
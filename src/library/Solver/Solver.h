@@ -2,6 +2,7 @@
 #define GEMPP_SOLVER_H
 
 #include "Configuration.h"
+#include "Core/CancellationToken.h"
 #include "Formulation/Solution.h"
 #include "IntegerProgramming/LinearProgram.h"
 #include "IntegerProgramming/QuadProgram.h"
@@ -12,9 +13,11 @@ class DLL_EXPORT Solver {
             CPLEX = 0,
             GLPK,
             GUROBI,
+            LAGRANGIAN,
             COUNT
         };
         static const char* solverName[COUNT];
+        Solver();
         virtual ~Solver() {}
         static Solvers fromName(QString name);
         static QString toName(Solvers solver);
@@ -28,10 +31,39 @@ class DLL_EXPORT Solver {
         virtual double solve(Solution *sol = 0) = 0;
         virtual void update(bool newBounds = false) = 0;
 
+        /**
+         * @brief Sets the token that bounds the solving time and allows to interrupt it.
+         * @param token the cancellation token, or 0
+         */
+        void setCancellationToken(CancellationToken *token);
+
+        /**
+         * @brief Interrupts the current resolution, the best solution found so far is kept.
+         * This method is called from another thread than the one running ::solve.
+         */
+        virtual void terminate() {}
+
     protected:
         LinearProgram *lp_;
         QuadProgram *qp_;
         Configuration *cfg_;
+        CancellationToken *token_;
+
+        /**
+         * @brief Returns the time limit of the next resolution, i.e. the minimum
+         * between the configuration time limit and the time left before the deadline.
+         * @return the time limit in seconds
+         */
+        double getTimeLimit() const;
+
+        /**
+         * @brief Fills a solution with the starting solution of the program, when the solver
+         * could not return a better one (see Program::setStart).
+         * @param sol the solution to fill, or 0
+         * @param status the status of the starting solution
+         * @return the objective value of the starting solution
+         */
+        double useStart(Solution *sol, Solution::Status status);
 
     private:
         virtual void addVar(Variable *v) = 0;
@@ -39,6 +71,18 @@ class DLL_EXPORT Solver {
         virtual void addQuadConstraint(QuadConstraint *c) = 0;
         virtual void setObjective() = 0;
         virtual void prepare() = 0;
+
+        /**
+         * @brief Forwards the branching priorities and the hint values of the variables to the solver.
+         * Solvers that can not use them simply ignore them.
+         */
+        virtual void setBranching() {}
+
+        /**
+         * @brief Forwards the starting solution of the program to the solver, and uses its
+         * objective value as a cutoff.
+         */
+        virtual void setStart() {}
 };
 
 Q_DECLARE_METATYPE(Solver::Solvers)
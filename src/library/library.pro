@@ -14,6 +14,8 @@ HEADERS += \
     Application/Widgets/QLabelItem.h \
     Application/Widgets/QVertexItem.h \
     Application/Widgets/QScienceSpinBox.h \
+    Core/Assignment.h \
+    Core/CancellationToken.h \
     Core/Constants.h \
     Core/Exception.h \
     Core/FileUtils.h \
@@ -31,6 +33,7 @@ HEADERS += \
     Core/Portability.h \
     Core/Printer.h \
     Core/Random.h \
+    Core/StringPool.h \
     Extraction/BinaryPNG.h \
     Extraction/ExtractionConfiguration.h \
     Extraction/GenericExtractor.h \
@@ -42,12 +45,24 @@ HEADERS += \
     Extraction/Vectorizer.h \
     Extraction/Zernike.h \
     Model/Attribute.h \
+    Model/AttributeTable.h \
+    Model/CompactGraph.h \
+    Model/CostCache.h \
+    Model/CostMatrices.h \
+    Model/CostProgram.h \
     Model/Edge.h \
+    Model/GMLReader.h \
+    Model/GXLReader.h \
     Model/Graph.h \
+    Model/GraphBuilder.h \
     Model/GraphList.h \
     Model/GraphElement.h \
+    Model/GraphView.h \
+    Model/LabelTable.h \
     Model/Metadata.h \
     Model/Problem.h \
+    Model/SubproblemMemo.h \
+    Model/Symmetry.h \
     Model/Vertex.h \
     Model/Weight.h \
     Model/WeightHash.h \
@@ -79,6 +94,7 @@ HEADERS += \
     Formulation/Solution.h \
     Formulation/SolutionList.h \
     Solver/Configuration.h \
+    Solver/LagrangianRelaxation.h \
     Solver/Matcher.h \
     Solver/Solver.h \
     Solver/SolverFactory.h \
@@ -93,6 +109,8 @@ SOURCES += \
     Application/Widgets/QLabelItem.cpp \
     Application/Widgets/QVertexItem.cpp \
     Application/Widgets/QScienceSpinBox.cpp \
+    Core/Assignment.cpp \
+    Core/CancellationToken.cpp \
     Core/Exception.cpp \
     Core/FileUtils.cpp \
     Core/Identified.cpp \
@@ -102,6 +120,7 @@ SOURCES += \
     Core/Math.cpp \
     Core/Printer.cpp \
     Core/Random.cpp \
+    Core/StringPool.cpp \
     Extraction/BinaryPNG.cpp \
     Extraction/ExtractionConfiguration.cpp \
     Extraction/GenericExtractor.cpp \
@@ -113,12 +132,24 @@ SOURCES += \
     Extraction/Vectorizer.cpp \
     Extraction/Zernike.cpp \
     Model/Attribute.cpp \
+    Model/AttributeTable.cpp \
+    Model/CompactGraph.cpp \
+    Model/CostCache.cpp \
+    Model/CostMatrices.cpp \
+    Model/CostProgram.cpp \
     Model/Edge.cpp \
+    Model/GMLReader.cpp \
+    Model/GXLReader.cpp \
     Model/Graph.cpp \
+    Model/GraphBuilder.cpp \
     Model/GraphList.cpp \
     Model/GraphElement.cpp \
+    Model/GraphView.cpp \
+    Model/LabelTable.cpp \
     Model/Metadata.cpp \
     Model/Problem.cpp \
+    Model/SubproblemMemo.cpp \
+    Model/Symmetry.cpp \
     Model/Vertex.cpp \
     Model/Weight.cpp \
     Model/WeightHash.cpp \
@@ -150,8 +181,12 @@ SOURCES += \
     Formulation/Solution.cpp \
     Formulation/SolutionList.cpp \
     Solver/Configuration.cpp \
+    Solver/LagrangianRelaxation.cpp \
     Solver/Matcher.cpp \
     Solver/Solver.cpp \
     Solver/PluginLoader.cpp
 
+# The cost kernels are written to be vectorized by the compiler
+linux: QMAKE_CXXFLAGS_RELEASE += -ftree-vectorize
+
 TARGET = $$qtLibraryTarget(GEM++)
@@ -45,8 +45,12 @@ void Cplex::prepare() {
 
     // Solver parameters
     cplex_->setParam(IloCplex::EpGap, pow(10, -PRECISION));
-    cplex_->setParam(IloCplex::TiLim, cfg_->timeLimit);
+    cplex_->setParam(IloCplex::TiLim, getTimeLimit());
     cplex_->setParam(IloCplex::Threads, cfg_->threadsPerInstance);
+
+    // Allows to interrupt the resolution from another thread
+    aborter_ = IloCplex::Aborter(*env_);
+    cplex_->use(aborter_);
 }
 
 void Cplex::update(bool newBounds) {
@@ -92,6 +96,8 @@ double Cplex::solve(Solution *sol) {
             obj = -INFINITY;
             break;
     }
+    // The deadline may have come closer since the model was prepared
+    cplex_->setParam(IloCplex::TiLim, getTimeLimit());
     cplex_->solve();
     Solution::Status status = Solution::NOT_SOLVED;
     switch(cplex_->getStatus()) {
@@ -117,6 +123,10 @@ double Cplex::solve(Solution *sol) {
             status = Solution::OPTIMAL;
             break;
     }
+    // The starting solution is kept if no solution as good has been found (e.g. it has been rejected),
+    // an infeasibility due to the cutoff proves it is optimal
+    if((lp_?(Program *)lp_:(Program *)qp_)->hasStart() && (status == Solution::NOT_SOLVED || status == Solution::INFEASIBLE))
+        return useStart(sol, (status == Solution::INFEASIBLE) ? Solution::OPTIMAL : Solution::SUBOPTIMAL);
     if(sol) {
         sol->clean();
         sol->setStatus(status);
@@ -135,6 +145,11 @@ double Cplex::solve(Solution *sol) {
     return obj;
 }
 
+void Cplex::terminate() {
+    if(cplex_)
+        aborter_.abort();
+}
+
 void Cplex::addVar(Variable *v) {
     IloNumVar::Type type = IloNumVar::Bool;
     switch(v->getType()) {
@@ -235,3 +250,41 @@ void Cplex::setObjective() {
     obj.setExpr(exp);
     model_->add(obj);
 }
+
+void Cplex::setBranching() {
+    IloNumVarArray hinted(*env_);
+    IloNumArray hints(*env_);
+    for(auto v : (lp_?(Program *)lp_:(Program *)qp_)->getVariables()) {
+        if(v->getBranchPriority() != 0)
+            cplex_->setPriority(variables_[varOrder_[v]], v->getBranchPriority());
+        if(v->hasHint()) {
+            hinted.add(variables_[varOrder_[v]]);
+            hints.add(v->getHint());
+        }
+    }
+    // Cplex has no hint values, they are given as a partial MIP start that it tries to repair
+    if(hinted.getSize() > 0)
+        cplex_->addMIPStart(hinted, hints, IloCplex::MIPStartRepair);
+    hinted.end();
+    hints.end();
+}
+
+void Cplex::setStart() {
+    Program *p = lp_?(Program *)lp_:(Program *)qp_;
+    if(!p->hasStart())
+        return;
+    IloNumVarArray vars(*env_);
+    IloNumArray vals(*env_);
+    for(auto it = p->getStart().begin(); it != p->getStart().end(); ++it) {
+        vars.add(variables_[varOrder_[it.key()]]);
+        vals.add(it.value());
+    }
+    cplex_->addMIPStart(vars, vals, IloCplex::MIPStartCheckFeas);
+    vars.end();
+    vals.end();
+    // The solutions as good as the start are still explored
+    if(p->getSense() == Program::MINIMIZE)
+        cplex_->setParam(IloCplex::CutUp, p->getStartObjective() + precision);
+    else
+        cplex_->setParam(IloCplex::CutLo, p->getStartObjective() - precision);
+}
@@ -16,11 +16,13 @@ class Cplex : public Solver {
         void init(Configuration *cfg);
         double solve(Solution *sol = 0);
         void update(bool newBounds = false);
+        void terminate();
 
     private:
         IloEnv *env_;
         IloModel *model_;
         IloCplex *cplex_;
+        IloCplex::Aborter aborter_;
         IloNumVarArray variables_;
         QHash<Variable*, int> varOrder_;
         QSet<QString> constraints_;
@@ -30,6 +32,8 @@ class Cplex : public Solver {
         void addQuadConstraint(QuadConstraint *c);
         void setObjective();
         void prepare();
+        void setBranching();
+        void setStart();
 };
 
 
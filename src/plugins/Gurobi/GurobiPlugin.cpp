@@ -38,7 +38,7 @@ void Gurobi::prepare() {
     // Parameters
     model_->getEnv().set(GRB_DoubleParam_MIPGap, pow(10, -GEMPP_PRECISION));
     model_->getEnv().set(GRB_IntParam_OutputFlag, cfg_->verbose);
-    model_->getEnv().set(GRB_DoubleParam_TimeLimit, cfg_->timeLimit);
+    model_->getEnv().set(GRB_DoubleParam_TimeLimit, getTimeLimit());
     model_->getEnv().set(GRB_IntParam_Threads, cfg_->threadsPerInstance);
 }
 
@@ -111,6 +111,8 @@ double Gurobi::solve(Solution *sol) {
             obj = -INFINITY;
             break;
     }
+    // The deadline may have come closer since the model was prepared
+    model_->getEnv().set(GRB_DoubleParam_TimeLimit, getTimeLimit());
     model_->optimize();
 
     Solution::Status status = Solution::NOT_SOLVED;
@@ -155,6 +157,13 @@ double Gurobi::solve(Solution *sol) {
             status = Solution::SUBOPTIMAL;
             break;
     }
+    // An interrupted resolution may not have found any solution
+    if(status == Solution::SUBOPTIMAL && model_->get(GRB_IntAttr_SolCount) == 0)
+        status = Solution::NOT_SOLVED;
+    // The starting solution is kept if no solution as good has been found (e.g. it has been rejected),
+    // a cutoff without any solution proves it is optimal
+    if((lp_?(Program *)lp_:(Program *)qp_)->hasStart() && model_->get(GRB_IntAttr_SolCount) == 0)
+        return useStart(sol, (status == Solution::OPTIMAL) ? Solution::OPTIMAL : Solution::SUBOPTIMAL);
     if(sol) {
         sol->clean();
         sol->setStatus(status);
@@ -171,6 +180,11 @@ double Gurobi::solve(Solution *sol) {
     return obj;
 }
 
+void Gurobi::terminate() {
+    if(model_)
+        model_->terminate();
+}
+
 void Gurobi::addVar(Variable *v) {
     char type = GRB_BINARY;
     switch(v->getType()) {
@@ -266,3 +280,26 @@ void Gurobi::setObjective() {
         model_->setObjective(qe);
     }
 }
+
+void Gurobi::setBranching() {
+    GRBVar var;
+    for(auto v : (lp_?(Program *)lp_:(Program *)qp_)->getVariables()) {
+        if(v->getBranchPriority() == 0 && !v->hasHint())
+            continue;
+        var = model_->getVarByName(v->getID().toStdString());
+        if(v->getBranchPriority() != 0)
+            var.set(GRB_IntAttr_BranchPriority, v->getBranchPriority());
+        if(v->hasHint())
+            var.set(GRB_DoubleAttr_VarHintVal, v->getHint());
+    }
+}
+
+void Gurobi::setStart() {
+    Program *p = lp_?(Program *)lp_:(Program *)qp_;
+    if(!p->hasStart())
+        return;
+    for(auto it = p->getStart().begin(); it != p->getStart().end(); ++it)
+        model_->getVarByName(it.key()->getID().toStdString()).set(GRB_DoubleAttr_Start, it.value());
+    // The solutions as good as the start are still explored
+    model_->getEnv().set(GRB_DoubleParam_Cutoff, p->getStartObjective() + ((p->getSense() == Program::MINIMIZE) ? precision : -precision));
+}
@@ -14,6 +14,7 @@ class Gurobi : public Solver {
         void init(Configuration *cfg);
         double solve(Solution *sol = 0);
         void update(bool newBounds = 0);
+        void terminate();
 
     private:
         GRBEnv *env_;
@@ -24,6 +25,8 @@ class Gurobi : public Solver {
         void addQuadConstraint(QuadConstraint *c);
         void setObjective();
         void prepare();
+        void setBranching();
+        void setStart();
 };
 
 class GurobiFactory : public QObject, public SolverFactory {
@@ -0,0 +1,187 @@
+#include <QtTest>
+#include <algorithm>
+#include "Model/GraphBuilder.h"
+
+/**
+ * @brief Checks that Graph::getCanonicalHash and Graph::isIsomorphic do not depend on the order
+ * of the vertices and edges, and that isIsomorphic tells apart the graphs whose hashes collide.
+ */
+class TestCanonicalHash : public QObject {
+        Q_OBJECT
+
+    private slots:
+        void permutation_data();
+        void permutation();
+        void components();
+        void regular();
+        void direction();
+        void attributes();
+};
+
+/**
+ * @brief A labelled graph, described by flat arrays as GraphBuilder expects.
+ */
+struct Description {
+    Graph::Type type;
+    QVector<int> origins, targets;
+    QVector<QString> vLabels, eLabels;
+};
+
+static Graph *build(const Description &d) {
+    GraphBuilder builder(d.type);
+    builder.setVertexCount(d.vLabels.size());
+    builder.setEdges(d.origins.size(), d.origins.constData(), d.targets.constData());
+    builder.addColumn(GraphElement::VERTEX, "label", d.vLabels.constData());
+    builder.addColumn(GraphElement::EDGE, "label", d.eLabels.constData());
+    return builder.build();
+}
+
+static Description unlabelled(Graph::Type type, int n, const QList<QPair<int, int> > &edges) {
+    Description d;
+    d.type = type;
+    d.vLabels = QVector<QString>(n, "C");
+    for(const QPair<int, int> &edge : edges) {
+        d.origins.append(edge.first);
+        d.targets.append(edge.second);
+        d.eLabels.append("single");
+    }
+    return d;
+}
+
+static Description randomGraph(Graph::Type type, int n, int m) {
+    const char *labels[] = {"C", "O", "N"};
+    const char *bonds[] = {"single", "double"};
+    Description d;
+    d.type = type;
+    for(int i=0; i < n; ++i)
+        d.vLabels.append(labels[qrand() % 3]);
+    // Neither loops nor parallel edges, so that the graph is simple whatever its type
+    QSet<QPair<int, int> > pairs;
+    int o, t;
+    while(d.origins.size() < m) {
+        o = qrand() % n;
+        t = qrand() % n;
+        if(o == t || pairs.contains(qMakePair(o, t)) || pairs.contains(qMakePair(t, o)))
+            continue;
+        pairs.insert(qMakePair(o, t));
+        d.origins.append(o);
+        d.targets.append(t);
+        d.eLabels.append(bonds[qrand() % 2]);
+    }
+    return d;
+}
+
+/**
+ * @brief Renumbers the vertices and shuffles the edges, turning the undirected edges around at random.
+ */
+static Description permute(const Description &d) {
+    int n = d.vLabels.size(), m = d.origins.size();
+    QVector<int> vertices(n), edges(m);
+    for(int i=0; i < n; ++i)
+        vertices[i] = i;
+    for(int ij=0; ij < m; ++ij)
+        edges[ij] = ij;
+    std::random_shuffle(vertices.begin(), vertices.end(), [](int k) { return qrand() % k; });
+    std::random_shuffle(edges.begin(), edges.end(), [](int k) { return qrand() % k; });
+
+    Description p;
+    p.type = d.type;
+    p.vLabels.resize(n);
+    for(int i=0; i < n; ++i)
+        p.vLabels[vertices[i]] = d.vLabels[i];
+    int o, t;
+    for(int ij : edges) {
+        o = vertices[d.origins[ij]];
+        t = vertices[d.targets[ij]];
+        if(d.type == Graph::UNDIRECTED && qrand() % 2)
+            qSwap(o, t);
+        p.origins.append(o);
+        p.targets.append(t);
+        p.eLabels.append(d.eLabels[ij]);
+    }
+    return p;
+}
+
+void TestCanonicalHash::permutation_data() {
+    QTest::addColumn<int>("type");
+    QTest::newRow("undirected") << (int) Graph::UNDIRECTED;
+    QTest::newRow("directed") << (int) Graph::DIRECTED;
+}
+
+void TestCanonicalHash::permutation() {
+    QFETCH(int, type);
+    qsrand(11);
+    int vertices;
+    for(int n=0; n < 50; ++n) {
+        vertices = 4 + n % 12;
+        Description d = randomGraph((Graph::Type) type, vertices, qMin(3 + n % 20, vertices*(vertices-1)/2));
+        QScopedPointer<Graph> g(build(d)), p(build(permute(d)));
+        QCOMPARE(p->getCanonicalHash(), g->getCanonicalHash());
+        QVERIFY(g->isIsomorphic(p.data()));
+        QVERIFY(p->isIsomorphic(g.data()));
+    }
+}
+
+void TestCanonicalHash::components() {
+    // A hexagon and two triangles are 2-regular, only the sizes of their components differ
+    QList<QPair<int, int> > cycle, triangles;
+    for(int i=0; i < 6; ++i) {
+        cycle.append(qMakePair(i, (i+1) % 6));
+        triangles.append(qMakePair(i, 3*(i/3) + (i+1) % 3));
+    }
+    QScopedPointer<Graph> hexagon(build(unlabelled(Graph::UNDIRECTED, 6, cycle))), twice(build(unlabelled(Graph::UNDIRECTED, 6, triangles)));
+    QVERIFY(hexagon->getCanonicalHash() != twice->getCanonicalHash());
+    QVERIFY(!hexagon->isIsomorphic(twice.data()));
+}
+
+void TestCanonicalHash::regular() {
+    // K3,3 and the triangular prism are connected and 3-regular: their hashes collide
+    QList<QPair<int, int> > bipartite, prism;
+    for(int i=0; i < 3; ++i)
+        for(int k=3; k < 6; ++k)
+            bipartite.append(qMakePair(i, k));
+    prism << qMakePair(0, 1) << qMakePair(1, 2) << qMakePair(2, 0)
+          << qMakePair(3, 4) << qMakePair(4, 5) << qMakePair(5, 3)
+          << qMakePair(0, 3) << qMakePair(1, 4) << qMakePair(2, 5);
+    QScopedPointer<Graph> g1(build(unlabelled(Graph::UNDIRECTED, 6, bipartite))), g2(build(unlabelled(Graph::UNDIRECTED, 6, prism)));
+    QCOMPARE(g1->getCanonicalHash(), g2->getCanonicalHash());
+    QVERIFY(!g1->isIsomorphic(g2.data()));
+    QVERIFY(!g2->isIsomorphic(g1.data()));
+}
+
+void TestCanonicalHash::direction() {
+    // A path and the same path with a reversed edge
+    QList<QPair<int, int> > path, reversed;
+    path << qMakePair(0, 1) << qMakePair(1, 2);
+    reversed << qMakePair(1, 0) << qMakePair(1, 2);
+    QScopedPointer<Graph> d1(build(unlabelled(Graph::DIRECTED, 3, path))), d2(build(unlabelled(Graph::DIRECTED, 3, reversed)));
+    QVERIFY(d1->getCanonicalHash() != d2->getCanonicalHash());
+    QVERIFY(!d1->isIsomorphic(d2.data()));
+
+    // Both are the same undirected path
+    QScopedPointer<Graph> u1(build(unlabelled(Graph::UNDIRECTED, 3, path))), u2(build(unlabelled(Graph::UNDIRECTED, 3, reversed)));
+    QCOMPARE(u1->getCanonicalHash(), u2->getCanonicalHash());
+    QVERIFY(u1->isIsomorphic(u2.data()));
+}
+
+void TestCanonicalHash::attributes() {
+    qsrand(5);
+    Description d = randomGraph(Graph::UNDIRECTED, 8, 12);
+    QScopedPointer<Graph> g(build(d));
+
+    Description vertex = d;
+    vertex.vLabels[3] = "Cl";
+    QScopedPointer<Graph> gv(build(vertex));
+    QVERIFY(gv->getCanonicalHash() != g->getCanonicalHash());
+    QVERIFY(!gv->isIsomorphic(g.data()));
+
+    Description edge = d;
+    edge.eLabels[5] = "triple";
+    QScopedPointer<Graph> ge(build(edge));
+    QVERIFY(ge->getCanonicalHash() != g->getCanonicalHash());
+    QVERIFY(!ge->isIsomorphic(g.data()));
+}
+
+QTEST_APPLESS_MAIN(TestCanonicalHash)
+
+#include "tst_canonicalhash.moc"
@@ -0,0 +1,4 @@
+ROOT = ../..
+include($$ROOT/tests/test.pri)
+SOURCES += tst_costmatrices.cpp
+TARGET = tst_costmatrices
@@ -0,0 +1,157 @@
+#include <QtTest>
+#include <QTemporaryDir>
+#include "Model/CostMatrices.h"
+#include "Model/Problem.h"
+
+/**
+ * @brief Checks that the costs of a ::Problem are read back unchanged from their ::CostMatrices.
+ */
+class TestCostMatrices : public QObject {
+        Q_OBJECT
+
+    private slots:
+        void init();
+        void cleanup();
+        void roundTrip_data();
+        void roundTrip();
+        void file();
+        void load();
+        void invalid();
+
+    private:
+        Graph *query_;
+        Graph *target_;
+        Weights *weights_;
+        Problem *problem_;
+};
+
+/**
+ * @brief Builds a graph whose vertices have a position and a label, and whose edges have a weight.
+ */
+static Graph *build(int n, const double *x, const QString *labels, int m, const int *origins, const int *targets, const double *w) {
+    Graph *graph = new Graph(Graph::UNDIRECTED);
+    Vertex *v;
+    for(int i=0; i < n; ++i) {
+        v = new Vertex();
+        v->addAttribute("x", QMetaType::Double, x[i]);
+        v->addAttribute("label", QMetaType::QString, labels[i]);
+        graph->addVertex(v);
+    }
+    Edge *e;
+    for(int ij=0; ij < m; ++ij) {
+        e = new Edge();
+        e->addAttribute("w", QMetaType::Double, w[ij]);
+        e->setOrigin(graph->getVertex(origins[ij]));
+        e->setTarget(graph->getVertex(targets[ij]));
+        graph->addEdge(e);
+        e->getOrigin()->addEdge(e, Vertex::EDGE_OUT);
+        e->getTarget()->addEdge(e, Vertex::EDGE_IN);
+    }
+    return graph;
+}
+
+void TestCostMatrices::init() {
+    // Two small labelled graphs, whose costs depend on numeric and symbolic attributes
+    const int qOrigins[] = {0, 1}, qTargets[] = {1, 2};
+    const double qX[] = {0.5, 1.0, 2.5}, qW[] = {1.0, 2.0};
+    const QString qLabels[] = {"C", "O", "C"};
+    query_ = build(3, qX, qLabels, 2, qOrigins, qTargets, qW);
+
+    const int tOrigins[] = {0, 1, 2, 3}, tTargets[] = {1, 2, 3, 0};
+    const double tX[] = {0.0, 1.5, 2.0, 4.0}, tW[] = {1.0, 1.5, 3.0, 0.5};
+    const QString tLabels[] = {"C", "C", "N", "O"};
+    target_ = build(4, tX, tLabels, 4, tOrigins, tTargets, tW);
+
+    weights_ = new Weights();
+    weights_->addWeight(Weights::SUBSTITUTION, GraphElement::VERTEX, "x", Weight::NUMERIC, 2, 1.5);
+    weights_->addWeight(Weights::SUBSTITUTION, GraphElement::VERTEX, "label", Weight::DISCRETE, 1, 1);
+    weights_->addWeight(Weights::SUBSTITUTION, GraphElement::EDGE, "w", Weight::NUMERIC, 1, 2);
+    problem_ = new Problem(Problem::GED, query_, target_);
+    problem_->computeCosts(weights_);
+}
+
+void TestCostMatrices::cleanup() {
+    delete problem_;
+    delete weights_;
+    delete query_;
+    delete target_;
+}
+
+static void compare(Problem *problem, const CostMatrices &costs, bool single) {
+    GraphElement::Type types[2] = {GraphElement::VERTEX, GraphElement::EDGE};
+    Graph *query = problem->getQuery(), *target = problem->getTarget();
+    int nQ, nT;
+    for(GraphElement::Type type : types) {
+        nQ = (type == GraphElement::VERTEX) ? query->getVertexCount() : query->getEdgeCount();
+        nT = (type == GraphElement::VERTEX) ? target->getVertexCount() : target->getEdgeCount();
+        QCOMPARE(costs.getQueryCount(type), nQ);
+        QCOMPARE(costs.getTargetCount(type), nT);
+        for(int i=0; i < nQ; ++i) {
+            double expected = (type == GraphElement::VERTEX) ? query->getVertex(i)->getCost() : query->getEdge(i)->getCost();
+            QCOMPARE(costs.getQueryCost(type, i), single ? (double)(float) expected : expected);
+        }
+        for(int k=0; k < nT; ++k) {
+            double expected = (type == GraphElement::VERTEX) ? target->getVertex(k)->getCost() : target->getEdge(k)->getCost();
+            QCOMPARE(costs.getTargetCost(type, k), single ? (double)(float) expected : expected);
+        }
+        for(int i=0; i < nQ; ++i) {
+            for(int k=0; k < nT; ++k) {
+                double expected = problem->getCost(type, i, k);
+                QCOMPARE(costs.getSubstitutionCost(type, i, k), single ? (double)(float) expected : expected);
+            }
+        }
+    }
+}
+
+void TestCostMatrices::roundTrip_data() {
+    QTest::addColumn<bool>("single");
+    QTest::newRow("float64") << false;
+    QTest::newRow("float32") << true;
+}
+
+void TestCostMatrices::roundTrip() {
+    QFETCH(bool, single);
+    QByteArray buffer = CostMatrices::encode(problem_, single);
+    CostMatrices costs(buffer);
+    QCOMPARE(costs.isSinglePrecision(), single);
+    compare(problem_, costs, single);
+}
+
+void TestCostMatrices::file() {
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QString filename = dir.path() + "/pair." + GEMPP_COST_EXT;
+    CostMatrices::save(problem_, filename);
+    CostMatrices costs(filename);
+    compare(problem_, costs, false);
+}
+
+void TestCostMatrices::load() {
+    // A problem reading the matrices has the costs of the one which computed them
+    Problem loaded(Problem::GED, query_, target_);
+    loaded.setCostMatrices(new CostMatrices(CostMatrices::encode(problem_)));
+    loaded.computeCosts(weights_);
+    for(int i=0; i < query_->getVertexCount(); ++i)
+        for(int k=0; k < target_->getVertexCount(); ++k)
+            QCOMPARE(loaded.getCost(GraphElement::VERTEX, i, k), problem_->getCost(GraphElement::VERTEX, i, k));
+    for(int ij=0; ij < query_->getEdgeCount(); ++ij)
+        for(int kl=0; kl < target_->getEdgeCount(); ++kl)
+            QCOMPARE(loaded.getCost(GraphElement::EDGE, ij, kl), problem_->getCost(GraphElement::EDGE, ij, kl));
+}
+
+void TestCostMatrices::invalid() {
+    QByteArray buffer = CostMatrices::encode(problem_);
+    QVERIFY_EXCEPTION_THROWN(CostMatrices header(buffer.left(16)), std::exception);
+    QVERIFY_EXCEPTION_THROWN(CostMatrices truncated(buffer.left(buffer.size() - 1)), std::exception);
+    buffer[0] = 'X';
+    QVERIFY_EXCEPTION_THROWN(CostMatrices magic(buffer), std::exception);
+
+    // The matrices of another pair of graphs are refused
+    Problem swapped(Problem::GED, target_, query_);
+    swapped.setCostMatrices(new CostMatrices(CostMatrices::encode(problem_)));
+    QVERIFY_EXCEPTION_THROWN(swapped.computeCosts(weights_), std::exception);
+}
+
+QTEST_GUILESS_MAIN(TestCostMatrices)
+
+#include "tst_costmatrices.moc"
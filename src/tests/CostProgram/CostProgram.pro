@@ -0,0 +1,4 @@
+ROOT = ../..
+include($$ROOT/tests/test.pri)
+SOURCES += tst_costprogram.cpp
+TARGET = tst_costprogram
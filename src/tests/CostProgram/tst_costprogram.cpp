@@ -0,0 +1,129 @@
+#include <QtTest>
+#include "Model/CostProgram.h"
+#include "Model/Graph.h"
+#include "Model/Weights.h"
+
+/**
+ * @brief Checks the costs of a compiled ::CostProgram, pair by pair and row by row, against Weights::substitutionCost.
+ */
+class TestCostProgram : public QObject {
+        Q_OBJECT
+
+    private slots:
+        void init();
+        void cleanup();
+        void costs_data();
+        void costs();
+        void missing();
+
+    private:
+        Graph *query_;
+        Graph *target_;
+};
+
+static void addVertex(Graph *graph, double x, int n, const QString &label, const QString &name) {
+    Vertex *v = new Vertex();
+    v->addAttribute("x", QMetaType::Double, x);
+    v->addAttribute("n", QMetaType::Int, n);
+    v->addAttribute("label", QMetaType::QString, label);
+    v->addAttribute("name", QMetaType::QString, name);
+    graph->addVertex(v);
+}
+
+void TestCostProgram::init() {
+    query_ = new Graph(Graph::UNDIRECTED);
+    addVertex(query_, 0.5, 1, "C", "carbon");
+    addVertex(query_, -1.25, 2, "O", "oxygen");
+    addVertex(query_, 3, 0, "C", "carbon");
+    target_ = new Graph(Graph::UNDIRECTED);
+    addVertex(target_, 0.5, 1, "C", "carbon");
+    addVertex(target_, 2, 4, "C", "carbone");
+    addVertex(target_, -1.25, 2, "N", "nitrogen");
+    addVertex(target_, 7.5, -3, "O", "oxygen");
+    addVertex(target_, 0, 0, "C", "");
+}
+
+void TestCostProgram::cleanup() {
+    delete query_;
+    delete target_;
+}
+
+void TestCostProgram::costs_data() {
+    QTest::addColumn<int>("mode");
+    QTest::addColumn<uint>("root");
+    QTest::addColumn<double>("discrete");
+
+    QTest::newRow("add") << (int) WeightHash::ADD << 1u << 1.0;
+    QTest::newRow("euclidean") << (int) WeightHash::ADD << 2u << 1.0;
+    QTest::newRow("multiply") << (int) WeightHash::MULTIPLY << 1u << 1.0;
+    QTest::newRow("no discrete") << (int) WeightHash::ADD << 1u << 0.0;
+}
+
+void TestCostProgram::costs() {
+    QFETCH(int, mode);
+    QFETCH(uint, root);
+    QFETCH(double, discrete);
+
+    Weights weights;
+    weights.addWeight(Weights::CREATION, GraphElement::VERTEX, "x", Weight::NUMERIC, 1, 0.5);
+    weights.addWeight(Weights::SUBSTITUTION, GraphElement::VERTEX, "x", Weight::NUMERIC, 2, 1.5);
+    weights.addWeight(Weights::SUBSTITUTION, GraphElement::VERTEX, "n", Weight::NUMERIC, 1, 0.25);
+    weights.addWeight(Weights::SUBSTITUTION, GraphElement::VERTEX, "label", Weight::DISCRETE, 1, discrete);
+    weights.addWeight(Weights::SUBSTITUTION, GraphElement::VERTEX, "name", Weight::STRING, 1, 0.5);
+    weights.getWeights(Weights::SUBSTITUTION, GraphElement::VERTEX)->setMode((WeightHash::Mode) mode);
+    weights.getWeights(Weights::SUBSTITUTION, GraphElement::VERTEX)->setRoot(root);
+    query_->computeCosts(&weights);
+    target_->computeCosts(&weights);
+
+    AttributeSchema schema;
+    AttributeTable queryTable(&schema, query_->getVertices()), targetTable(&schema, target_->getVertices());
+    CostProgram program = weights.compile(&schema, GraphElement::VERTEX);
+    int nT = target_->getVertexCount();
+    QVector<double> creations(nT), row(nT);
+    for(int k=0; k < nT; ++k)
+        creations[k] = target_->getVertex(k)->getCost();
+
+    Vertex *v1, *v2;
+    for(int i=0; i < query_->getVertexCount(); ++i) {
+        v1 = query_->getVertex(i);
+        QVERIFY(program.substitutionCosts(v1, &queryTable, &targetTable, creations.constData(), 0, nT, row.data()));
+        for(int k=0; k < nT; ++k) {
+            v2 = target_->getVertex(k);
+            QCOMPARE(program.substitutionCost(v1, v2, &queryTable, &targetTable), weights.substitutionCost(v1, v2));
+            QCOMPARE(row[k], weights.substitutionCost(v1, v2));
+        }
+
+        // A range of the rows is written from the start of the result
+        QVERIFY(program.substitutionCosts(v1, &queryTable, &targetTable, creations.constData(), 1, nT - 1, row.data()));
+        for(int k=1; k < nT - 1; ++k)
+            QCOMPARE(row[k-1], weights.substitutionCost(v1, target_->getVertex(k)));
+    }
+}
+
+void TestCostProgram::missing() {
+    // The row kernel gives up on a column missing values, the pairwise costs are still defined
+    Vertex *v = new Vertex();
+    v->addAttribute("x", QMetaType::Double, 1.0);
+    target_->addVertex(v);
+
+    Weights weights;
+    weights.addWeight(Weights::SUBSTITUTION, GraphElement::VERTEX, "x", Weight::NUMERIC, 1, 1);
+    weights.addWeight(Weights::SUBSTITUTION, GraphElement::VERTEX, "n", Weight::NUMERIC, 1, 1);
+    query_->computeCosts(&weights);
+    target_->computeCosts(&weights);
+
+    AttributeSchema schema;
+    AttributeTable queryTable(&schema, query_->getVertices()), targetTable(&schema, target_->getVertices());
+    CostProgram program = weights.compile(&schema, GraphElement::VERTEX);
+    int nT = target_->getVertexCount();
+    QVector<double> creations(nT), row(nT);
+    for(int k=0; k < nT; ++k)
+        creations[k] = target_->getVertex(k)->getCost();
+    QVERIFY(!program.substitutionCosts(query_->getVertex(0), &queryTable, &targetTable, creations.constData(), 0, nT, row.data()));
+    for(int k=0; k < nT - 1; ++k)
+        QCOMPARE(program.substitutionCost(query_->getVertex(0), target_->getVertex(k), &queryTable, &targetTable), weights.substitutionCost(query_->getVertex(0), target_->getVertex(k)));
+}
+
+QTEST_APPLESS_MAIN(TestCostProgram)
+
+#include "tst_costprogram.moc"
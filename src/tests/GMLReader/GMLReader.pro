@@ -0,0 +1,4 @@
+ROOT = ../..
+include($$ROOT/tests/test.pri)
+SOURCES += tst_gmlreader.cpp
+TARGET = tst_gmlreader
@@ -0,0 +1,170 @@
+#include <QtTest>
+#include <QTemporaryDir>
+#include "Core/FileUtils.h"
+#include "Model/GMLReader.h"
+#include "GraphComparison.h"
+
+/**
+ * @brief Checks the streaming GML reader against the former loader, which scanned the file with
+ * regular expressions, and measures both.
+ */
+class TestGMLReader : public QObject {
+        Q_OBJECT
+
+    private slots:
+        void initTestCase();
+        void fixture();
+        void saved();
+        void unknownVertex();
+        void benchmark_data();
+        void benchmark();
+
+    private:
+        QTemporaryDir dir_;
+        QString large_;
+};
+
+/**
+ * The loader of Graph::fromGML before GMLReader, written with the public methods of ::Graph.
+ */
+static void loadLegacy(Graph *graph, const QString &filename) {
+    QString buffer = FileUtils::load(filename);
+    QRegExp directed = QRegExp("directed (0|1)");
+    QRegExp vertex_begin = QRegExp(GraphElement::toName(GraphElement::VERTEX) + " \\[");
+    QRegExp edge_begin = QRegExp(GraphElement::toName(GraphElement::EDGE) + " \\[");
+    QRegExp group_end = QRegExp("\\]");
+    QString id;
+    QString label;
+    Vertex *v = 0;
+    Edge *e = 0;
+
+    // Graph type
+    int begin = directed.indexIn(buffer), end;
+    QStringList sl = buffer.mid(begin, directed.matchedLength()).simplified().split(" ");
+    graph->setType((sl[1].toInt())? Graph::DIRECTED : Graph::UNDIRECTED);
+
+    // Parse vertices
+    begin = vertex_begin.indexIn(buffer);
+    begin += vertex_begin.matchedLength();
+    end = group_end.indexIn(buffer, begin);
+    while(begin >= 0) {
+        v = new Vertex();
+        label = "";
+        sl = buffer.mid(begin, end-begin).simplified().split(" ");
+        if(sl.size() > 1) {
+            for(auto it = sl.begin(); it != sl.end() && it+1 != sl.end(); it += 2) {
+                if(!it->compare("id", Qt::CaseInsensitive)) {
+                    id = *(it+1);
+                } else if(!it->compare("label", Qt::CaseInsensitive)) {
+                    label = (it+1)->remove('\"');
+                } else if(it->compare("comment", Qt::CaseInsensitive)) {
+                    if((it+1)->contains('\"'))
+                        v->addAttribute(*it, QMetaType::QString, *(it+1));
+                    else if((it+1)->contains("."))
+                        v->addAttribute(*it, QMetaType::Double, (it+1)->toDouble());
+                    else
+                        v->addAttribute(*it, QMetaType::Int, (it+1)->toInt());
+                }
+            }
+        }
+        if(!label.isEmpty())
+            v->setID(label);
+        graph->addVertex(v, id);
+
+        begin = vertex_begin.indexIn(buffer, begin);
+        begin += vertex_begin.matchedLength();
+        end = group_end.indexIn(buffer, begin);
+    }
+
+    // Parse edges
+    begin = edge_begin.indexIn(buffer);
+    begin += edge_begin.matchedLength();
+    end = group_end.indexIn(buffer, begin);
+    while(begin >= 0) {
+        sl = buffer.mid(begin, end-begin).simplified().split(" ");
+        e = new Edge();
+        label = "";
+        for(auto it = sl.begin(); it != sl.end() && it+1 != sl.end(); it += 2) {
+            if(!it->compare("source", Qt::CaseInsensitive)) {
+                e->setOrigin(graph->getVertex(*(it+1)));
+            } else if(!it->compare("target", Qt::CaseInsensitive)) {
+                e->setTarget(graph->getVertex(*(it+1)));
+            } else if(!it->compare("label", Qt::CaseInsensitive)) {
+                label = (it+1)->remove('\"');
+            } else if(it->compare("comment", Qt::CaseInsensitive)) {
+                if((it+1)->contains('\"'))
+                    e->addAttribute(*it, QMetaType::QString, *(it+1));
+                else if((it+1)->contains("."))
+                    e->addAttribute(*it, QMetaType::Double, (it+1)->toDouble());
+                else
+                    e->addAttribute(*it, QMetaType::Int, (it+1)->toInt());
+            }
+        }
+        if(!label.isEmpty())
+            e->setID(label);
+        graph->addEdge(e);
+        e = graph->getEdges().last();
+        e->getOrigin()->addEdge(e, Vertex::EDGE_OUT);
+        e->getTarget()->addEdge(e, Vertex::EDGE_IN);
+
+        begin = edge_begin.indexIn(buffer, begin);
+        begin += edge_begin.matchedLength();
+        end = group_end.indexIn(buffer, begin);
+    }
+}
+
+static void compareLoaders(const QString &filename) {
+    Graph read, legacy;
+    GMLReader(filename).read(&read);
+    loadLegacy(&legacy, filename);
+    compareGraphs(&read, &legacy);
+}
+
+void TestGMLReader::initTestCase() {
+    QVERIFY(dir_.isValid());
+
+    // A large random graph, written by Graph::save
+    qsrand(7);
+    QScopedPointer<Graph> graph(randomGraph(Graph::UNDIRECTED, 20000, 40000));
+    large_ = dir_.path() + "/large.gml";
+    graph->save(large_);
+}
+
+void TestGMLReader::fixture() {
+    compareLoaders(GEMPP_FIXTURES "/molecule.gml");
+}
+
+void TestGMLReader::saved() {
+    compareLoaders(large_);
+}
+
+void TestGMLReader::unknownVertex() {
+    QString filename = dir_.path() + "/unknown.gml";
+    QFile file(filename);
+    QVERIFY(file.open(QFile::WriteOnly));
+    file.write("graph [\n directed 1\n node [\n id 0\n ]\n edge [\n source 0\n target 1\n ]\n]\n");
+    file.close();
+    Graph graph;
+    QVERIFY_EXCEPTION_THROWN(GMLReader(filename).read(&graph), std::exception);
+}
+
+void TestGMLReader::benchmark_data() {
+    QTest::addColumn<bool>("legacy");
+    QTest::newRow("GMLReader") << false;
+    QTest::newRow("legacy") << true;
+}
+
+void TestGMLReader::benchmark() {
+    QFETCH(bool, legacy);
+    QBENCHMARK {
+        Graph graph;
+        if(legacy)
+            loadLegacy(&graph, large_);
+        else
+            GMLReader(large_).read(&graph);
+    }
+}
+
+QTEST_GUILESS_MAIN(TestGMLReader)
+
+#include "tst_gmlreader.moc"
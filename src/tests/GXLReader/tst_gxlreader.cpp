@@ -0,0 +1,102 @@
+#include <QtTest>
+#include <QTemporaryDir>
+#include "Model/GXLReader.h"
+#include "GraphComparison.h"
+
+/**
+ * @brief Checks the streaming GXL reader against the DOM loader, Graph::load(QDomElement),
+ * and measures both.
+ */
+class TestGXLReader : public QObject {
+        Q_OBJECT
+
+    private slots:
+        void initTestCase();
+        void fixture_data();
+        void fixture();
+        void saved();
+        void unknownVertex();
+        void benchmark_data();
+        void benchmark();
+
+    private:
+        QTemporaryDir dir_;
+        QString large_;
+};
+
+/**
+ * Both loaders name the graph after the file first, as Graph::load(const QString &) does.
+ */
+static bool loadStream(Graph *graph, const QString &filename) {
+    graph->setID(QFileInfo(filename).completeBaseName());
+    return GXLReader(filename).read(graph);
+}
+
+static bool loadNamedDOM(Graph *graph, const QString &filename) {
+    graph->setID(QFileInfo(filename).completeBaseName());
+    return loadDOM(graph, filename);
+}
+
+static void compareLoaders(const QString &filename) {
+    Graph read, dom;
+    QVERIFY(loadStream(&read, filename));
+    QVERIFY(loadNamedDOM(&dom, filename));
+    compareGraphs(&read, &dom);
+}
+
+void TestGXLReader::initTestCase() {
+    QVERIFY(dir_.isValid());
+
+    // A large random graph, written by Graph::save
+    qsrand(7);
+    QScopedPointer<Graph> graph(randomGraph(Graph::DIRECTED, 20000, 40000));
+    large_ = dir_.path() + "/large.gxl";
+    graph->save(large_);
+}
+
+void TestGXLReader::fixture_data() {
+    QTest::addColumn<QString>("filename");
+    QTest::newRow("molecule") << QString(GEMPP_FIXTURES "/molecule.gxl");
+    QTest::newRow("hierarchy") << QString(GEMPP_FIXTURES "/hierarchy.gxl");
+}
+
+void TestGXLReader::fixture() {
+    QFETCH(QString, filename);
+    compareLoaders(filename);
+}
+
+void TestGXLReader::saved() {
+    compareLoaders(large_);
+}
+
+void TestGXLReader::unknownVertex() {
+    // The reader gives up, so that Graph::load falls back to the DOM
+    QString filename = dir_.path() + "/unknown.gxl";
+    QFile file(filename);
+    QVERIFY(file.open(QFile::WriteOnly));
+    file.write("<gxl><graph edgemode=\"directed\"><node id=\"0\"/><edge from=\"0\" to=\"1\"/></graph></gxl>\n");
+    file.close();
+    Graph graph;
+    QVERIFY(!GXLReader(filename).read(&graph));
+}
+
+void TestGXLReader::benchmark_data() {
+    QTest::addColumn<bool>("dom");
+    QTest::newRow("GXLReader") << false;
+    QTest::newRow("DOM") << true;
+}
+
+void TestGXLReader::benchmark() {
+    QFETCH(bool, dom);
+    QBENCHMARK {
+        Graph graph;
+        if(dom)
+            loadNamedDOM(&graph, large_);
+        else
+            loadStream(&graph, large_);
+    }
+}
+
+QTEST_GUILESS_MAIN(TestGXLReader)
+
+#include "tst_gxlreader.moc"
@@ -0,0 +1,75 @@
+#include <QtTest>
+#include "GraphComparison.h"
+
+/**
+ * @brief Checks the graphs built from arrays against the same graph loaded from a GXL file.
+ */
+class TestGraphBuilder : public QObject {
+        Q_OBJECT
+
+    private slots:
+        void build();
+        void buildCompact();
+        void invalid();
+};
+
+static const int origins[] = {0, 0, 2, 3};
+static const int targets[] = {1, 2, 3, 0};
+static const int charges[] = {0, -1, 0, 1};
+static const QString chems[] = {"C", "O", "C", "N"};
+static const double xs[] = {1.5, 2.25, -0.5, 0};
+static const int valences[] = {2, 1, 1, 3};
+
+static void fill(GraphBuilder &builder) {
+    builder.setVertexCount(4);
+    builder.setEdges(4, origins, targets);
+    // The columns are not given in the order of their names
+    builder.addColumn(GraphElement::VERTEX, "x", xs);
+    builder.addColumn(GraphElement::VERTEX, "chem", chems);
+    builder.addColumn(GraphElement::VERTEX, "charge", charges);
+    builder.addColumn(GraphElement::EDGE, "valence", valences);
+}
+
+void TestGraphBuilder::build() {
+    GraphBuilder builder(Graph::UNDIRECTED);
+    fill(builder);
+    QScopedPointer<Graph> built(builder.build());
+    Graph loaded;
+    QVERIFY(loadDOM(&loaded, GEMPP_FIXTURES "/molecule.gxl"));
+    compareGraphs(built.data(), &loaded);
+}
+
+void TestGraphBuilder::buildCompact() {
+    GraphBuilder builder(Graph::UNDIRECTED);
+    fill(builder);
+    QScopedPointer<Graph> built(builder.build());
+    QScopedPointer<CompactGraph> compact(builder.buildCompact());
+    CompactGraph reference(built.data());
+    QCOMPARE(compact->getVertexCount(), reference.getVertexCount());
+    QCOMPARE(compact->getEdgeCount(), reference.getEdgeCount());
+    QCOMPARE(compact->isDirected(), reference.isDirected());
+    for(int ij=0; ij < reference.getEdgeCount(); ++ij) {
+        QCOMPARE(compact->getOrigin(ij), reference.getOrigin(ij));
+        QCOMPARE(compact->getTarget(ij), reference.getTarget(ij));
+    }
+    for(int i=0; i < reference.getVertexCount(); ++i) {
+        QCOMPARE(compact->getDegree(i), reference.getDegree(i));
+        for(int e=0; e < reference.getDegree(i); ++e)
+            QCOMPARE(compact->getEdge(i, e, Vertex::EDGE_IN_OUT), reference.getEdge(i, e, Vertex::EDGE_IN_OUT));
+    }
+}
+
+void TestGraphBuilder::invalid() {
+    const int outside[] = {0, 4};
+    GraphBuilder builder;
+    builder.setVertexCount(4);
+    builder.setEdges(1, outside, outside + 1);
+    QVERIFY_EXCEPTION_THROWN(builder.build(), std::exception);
+    QVERIFY_EXCEPTION_THROWN(builder.buildCompact(), std::exception);
+    QVERIFY_EXCEPTION_THROWN(builder.setVertexCount(-1), std::exception);
+    QVERIFY_EXCEPTION_THROWN(builder.addColumn(GraphElement::GRAPH, "x", xs), std::exception);
+}
+
+QTEST_APPLESS_MAIN(TestGraphBuilder)
+
+#include "tst_graphbuilder.moc"
@@ -0,0 +1,100 @@
+#ifndef GEMPP_TESTS_GRAPHCOMPARISON_H
+#define GEMPP_TESTS_GRAPHCOMPARISON_H
+
+#include <QtTest>
+#include <QDomDocument>
+#include "Model/Graph.h"
+#include "Model/GraphBuilder.h"
+
+/**
+ * @brief Checks that two elements have the same identifier and attributes.
+ * @param e1 the first element
+ * @param e2 the second element
+ */
+inline void compareElements(const GraphElement *e1, const GraphElement *e2) {
+    QCOMPARE(e1->getID(), e2->getID());
+    QCOMPARE(e1->getAttributeNames(), e2->getAttributeNames());
+    for(const QString &name : e1->getAttributeNames()) {
+        QCOMPARE((int) e1->getAttribute(name)->getType(), (int) e2->getAttribute(name)->getType());
+        QCOMPARE(e1->getAttribute(name)->getValue(), e2->getAttribute(name)->getValue());
+    }
+    QCOMPARE(e1->getGraph() != 0, e2->getGraph() != 0);
+}
+
+/**
+ * @brief Checks that two graphs are equal, following the indexes of their elements,
+ * their attributes and subgraphs included.
+ * @param g1 the first graph
+ * @param g2 the second graph
+ */
+inline void compareGraphs(const Graph *g1, const Graph *g2) {
+    compareElements(g1, g2);
+    QCOMPARE((int) g1->getType(), (int) g2->getType());
+    QCOMPARE(g1->getVertexCount(), g2->getVertexCount());
+    QCOMPARE(g1->getEdgeCount(), g2->getEdgeCount());
+    for(int i=0; i < g1->getVertexCount(); ++i) {
+        compareElements(g1->getVertex(i), g2->getVertex(i));
+        QCOMPARE(g1->getVertex(i)->getDegree(), g2->getVertex(i)->getDegree());
+        if(g1->getVertex(i)->getGraph() && g2->getVertex(i)->getGraph())
+            compareGraphs(g1->getVertex(i)->getGraph(), g2->getVertex(i)->getGraph());
+    }
+    for(int ij=0; ij < g1->getEdgeCount(); ++ij) {
+        compareElements(g1->getEdge(ij), g2->getEdge(ij));
+        QCOMPARE(g1->getEdge(ij)->getOrigin()->getIndex(), g2->getEdge(ij)->getOrigin()->getIndex());
+        QCOMPARE(g1->getEdge(ij)->getTarget()->getIndex(), g2->getEdge(ij)->getTarget()->getIndex());
+        if(g1->getEdge(ij)->getGraph() && g2->getEdge(ij)->getGraph())
+            compareGraphs(g1->getEdge(ij)->getGraph(), g2->getEdge(ij)->getGraph());
+    }
+}
+
+/**
+ * @brief Loads the first graph of a GXL file with the DOM, i.e. Graph::load(QDomElement).
+ * @param graph the graph, which should be empty
+ * @param filename the GXL file
+ * @return whether the file has been parsed
+ */
+inline bool loadDOM(Graph *graph, const QString &filename) {
+    QFile file(filename);
+    if(!file.open(QFile::ReadOnly))
+        return false;
+    QDomDocument document;
+    if(!document.setContent(&file))
+        return false;
+    graph->load(document.documentElement().firstChildElement(GraphElement::toName(GraphElement::GRAPH)));
+    return true;
+}
+
+/**
+ * @brief Builds a random molecule-like graph, with an integer, a textual and a floating point
+ * attribute on the vertices, and an integer attribute on the edges. The graph depends on the seed of qrand.
+ * @param type the type of the graph
+ * @param vertexCount the number of vertices
+ * @param edgeCount the number of edges, which may join a vertex to itself
+ * @return the graph, owned by the caller
+ */
+inline Graph *randomGraph(Graph::Type type, int vertexCount, int edgeCount) {
+    QVector<int> origins(edgeCount), targets(edgeCount), charges(vertexCount), valences(edgeCount);
+    QVector<double> xs(vertexCount);
+    QVector<QString> chems(vertexCount);
+    const char *elements[] = {"C", "O", "N", "Cl"};
+    for(int i=0; i < vertexCount; ++i) {
+        charges[i] = qrand() % 3 - 1;
+        xs[i] = (qrand() % 1000) / 8.0;
+        chems[i] = elements[qrand() % 4];
+    }
+    for(int ij=0; ij < edgeCount; ++ij) {
+        origins[ij] = qrand() % vertexCount;
+        targets[ij] = qrand() % vertexCount;
+        valences[ij] = 1 + qrand() % 3;
+    }
+    GraphBuilder builder(type);
+    builder.setVertexCount(vertexCount);
+    builder.setEdges(edgeCount, origins.constData(), targets.constData());
+    builder.addColumn(GraphElement::VERTEX, "charge", charges.constData());
+    builder.addColumn(GraphElement::VERTEX, "chem", chems.constData());
+    builder.addColumn(GraphElement::VERTEX, "x", xs.constData());
+    builder.addColumn(GraphElement::EDGE, "valence", valences.constData());
+    return builder.build();
+}
+
+#endif /* GEMPP_TESTS_GRAPHCOMPARISON_H */
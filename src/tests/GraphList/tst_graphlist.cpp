@@ -0,0 +1,85 @@
+#include <QtTest>
+#include <QTemporaryDir>
+#include "Model/GraphList.h"
+
+/**
+ * @brief Checks that the graphs loaded in parallel follow the natural order of their files,
+ * and that the files which cannot be loaded are reported.
+ */
+class TestGraphList : public QObject {
+        Q_OBJECT
+
+    private slots:
+        void initTestCase();
+        void order();
+        void errors();
+
+    private:
+        QTemporaryDir dir_;
+};
+
+static bool write(const QString &filename, const QByteArray &content) {
+    QFile file(filename);
+    return file.open(QFile::WriteOnly) && file.write(content) == content.size();
+}
+
+void TestGraphList::initTestCase() {
+    QVERIFY(dir_.isValid());
+
+    // The files are created out of their natural order, and the copies follow the first one of their class
+    QDir dir(dir_.path());
+    QVERIFY(dir.mkdir("valid"));
+    QVERIFY(dir.mkdir("broken"));
+    QVERIFY(QFile::copy(GEMPP_FIXTURES "/molecule.gxl", dir_.path() + "/valid/g10.gxl"));
+    QVERIFY(QFile::copy(GEMPP_FIXTURES "/hierarchy.gxl", dir_.path() + "/valid/g2.gxl"));
+    QVERIFY(QFile::copy(GEMPP_FIXTURES "/molecule.gml", dir_.path() + "/valid/g3.gml"));
+    QVERIFY(QFile::copy(GEMPP_FIXTURES "/molecule.gxl", dir_.path() + "/valid/g1.gxl"));
+    QVERIFY(QFile::copy(GEMPP_FIXTURES "/molecule.gxl", dir_.path() + "/valid/g9.gxl"));
+    QVERIFY(write(dir_.path() + "/valid/notes.txt", "not a graph"));
+
+    // The GML reader raises the errors, the GXL files fall back to the DOM which reads any document
+    QVERIFY(QFile::copy(GEMPP_FIXTURES "/molecule.gxl", dir_.path() + "/broken/g1.gxl"));
+    QVERIFY(write(dir_.path() + "/broken/g2.gml", "graph [ node [ id 0 ]"));
+    QVERIFY(QFile::copy(GEMPP_FIXTURES "/molecule.gxl", dir_.path() + "/broken/g3.gxl"));
+    QVERIFY(write(dir_.path() + "/broken/g4.gml", "graph [ node [ id 0 ] edge [ source 0 target 7 ] ]"));
+}
+
+void TestGraphList::order() {
+    GraphList list(QDir(dir_.path() + "/valid"));
+    QCOMPARE(list.getGraphCount(), 5);
+    QStringList ids;
+    for(int i=0; i < list.getGraphCount(); ++i) {
+        QCOMPARE(list.getGraph(i)->getIndex(), i);
+        ids << list.getGraph(i)->getID();
+    }
+    QCOMPARE(ids, QStringList() << "g1" << "g2" << "g3" << "g9" << "g10");
+    QVERIFY(list.getErrors().isEmpty());
+    list.checkErrors();
+
+    // The copies are gathered with the first of them
+    QCOMPARE(list.getClass(0), 0);
+    QCOMPARE(list.getClass(1), 1);
+    QCOMPARE(list.getClass(3), 0);
+    QCOMPARE(list.getClass(4), 0);
+    QCOMPARE(list.getCanonicalHash(4), list.getCanonicalHash(0));
+}
+
+void TestGraphList::errors() {
+    GraphList list(QDir(dir_.path() + "/broken"));
+
+    // The valid files are still loaded, in order
+    QCOMPARE(list.getGraphCount(), 2);
+    QCOMPARE(list.getGraph(0)->getID(), QString("g1"));
+    QCOMPARE(list.getGraph(1)->getID(), QString("g3"));
+    QCOMPARE(list.getGraph(1)->getIndex(), 1);
+
+    // Each error is prefixed by its file, in the order of the files
+    QCOMPARE(list.getErrors().size(), 2);
+    QVERIFY(list.getErrors()[0].startsWith(dir_.path() + "/broken/g2.gml: "));
+    QVERIFY(list.getErrors()[1].startsWith(dir_.path() + "/broken/g4.gml: "));
+    QVERIFY_EXCEPTION_THROWN(list.checkErrors(), std::exception);
+}
+
+QTEST_APPLESS_MAIN(TestGraphList)
+
+#include "tst_graphlist.moc"
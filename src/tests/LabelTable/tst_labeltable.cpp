@@ -0,0 +1,158 @@
+#include <QtTest>
+#include "Model/LabelTable.h"
+
+/**
+ * @brief Checks the costs tabulated by a ::LabelTable against the ones computed pair by pair by ::Weights.
+ */
+class TestLabelTable : public QObject {
+        Q_OBJECT
+
+    private slots:
+        void init();
+        void cleanup();
+        void labels();
+        void costs();
+        void hierarchical();
+        void invalid();
+
+    private:
+        Weights *weights_;
+        QList<Graph *> graphs_;
+};
+
+static Graph *randomGraph(int n, int m) {
+    const char *chems[] = {"C", "O", "N", "Cl"};
+    const double charges[] = {-1, 0, 0.5, 1};
+    Graph *graph = new Graph(Graph::UNDIRECTED);
+    Vertex *v;
+    for(int i=0; i < n; ++i) {
+        v = new Vertex();
+        v->addAttribute("chem", QMetaType::QString, chems[qrand() % 4]);
+        v->addAttribute("charge", QMetaType::Double, charges[qrand() % 4]);
+        graph->addVertex(v);
+    }
+    Edge *e;
+    for(int ij=0; ij < m; ++ij) {
+        e = new Edge();
+        e->setOrigin(graph->getVertex(qrand() % n));
+        e->setTarget(graph->getVertex(qrand() % n));
+        e->addAttribute("valence", QMetaType::Int, 1 + qrand() % 3);
+        graph->addEdge(e);
+        e->getOrigin()->addEdge(e, Vertex::EDGE_OUT);
+        e->getTarget()->addEdge(e, Vertex::EDGE_IN);
+    }
+    return graph;
+}
+
+void TestLabelTable::init() {
+    // The attributes take few values, so that the labels repeat within and across the graphs
+    qsrand(3);
+    for(int g=0; g < 4; ++g)
+        graphs_.append(randomGraph(6 + 2*g, 8 + 3*g));
+    weights_ = new Weights();
+    weights_->addWeight(Weights::CREATION, GraphElement::VERTEX, "chem", Weight::CONSTANT, 1, 2);
+    weights_->addWeight(Weights::SUBSTITUTION, GraphElement::VERTEX, "chem", Weight::STRING, 1, 1);
+    weights_->addWeight(Weights::SUBSTITUTION, GraphElement::VERTEX, "charge", Weight::NUMERIC, 2, 1.5);
+    weights_->addWeight(Weights::SUBSTITUTION, GraphElement::EDGE, "valence", Weight::NUMERIC, 1, 0.5);
+}
+
+void TestLabelTable::cleanup() {
+    qDeleteAll(graphs_);
+    graphs_.clear();
+    delete weights_;
+}
+
+void TestLabelTable::labels() {
+    LabelTable table(weights_);
+    for(Graph *graph : graphs_)
+        table.addGraph(graph);
+    GraphElement::Type types[2] = {GraphElement::VERTEX, GraphElement::EDGE};
+    for(GraphElement::Type type : types) {
+        // Two elements share a label exactly when their attributes are equal
+        QList<GraphElement *> elements;
+        QList<int> labels;
+        for(Graph *graph : graphs_) {
+            QVERIFY(table.contains(graph));
+            int count = (type == GraphElement::VERTEX) ? graph->getVertexCount() : graph->getEdgeCount();
+            QCOMPARE(table.getLabels(graph, type).size(), count);
+            for(int i=0; i < count; ++i) {
+                elements.append((type == GraphElement::VERTEX) ? (GraphElement *) graph->getVertex(i) : (GraphElement *) graph->getEdge(i));
+                labels.append(table.getLabels(graph, type)[i]);
+            }
+        }
+        QSet<int> distinct;
+        for(int a=0; a < elements.size(); ++a) {
+            distinct.insert(labels[a]);
+            for(int b=0; b < elements.size(); ++b) {
+                bool equal = (elements[a]->getAttributeNames() == elements[b]->getAttributeNames());
+                for(const QString &name : elements[a]->getAttributeNames())
+                    equal = equal && (elements[a]->getAttribute(name)->getValue() == elements[b]->getAttribute(name)->getValue());
+                QCOMPARE(labels[a] == labels[b], equal);
+            }
+        }
+        QCOMPARE(table.getLabelCount(type), distinct.size());
+        QVERIFY(table.getLabelCount(type) < elements.size());
+    }
+}
+
+void TestLabelTable::costs() {
+    LabelTable table(weights_);
+    for(Graph *graph : graphs_)
+        table.addGraph(graph);
+    QVERIFY(!table.isTabulated(GraphElement::VERTEX));
+    table.computeCosts();
+    QVERIFY(table.isTabulated(GraphElement::VERTEX));
+    QVERIFY(table.isTabulated(GraphElement::EDGE));
+
+    // The creation costs set by the table
+    double total;
+    for(Graph *graph : graphs_) {
+        total = 0;
+        for(Vertex *v : graph->getVertices()) {
+            QCOMPARE(v->getCost(), weights_->creationCost(v));
+            total += v->getCost();
+        }
+        for(Edge *e : graph->getEdges()) {
+            QCOMPARE(e->getCost(), weights_->creationCost(e));
+            total += e->getCost();
+        }
+        QCOMPARE(graph->getCost(), total);
+    }
+
+    // The substitution costs of each pair of elements, within and across the graphs
+    for(Graph *g1 : graphs_) {
+        for(Graph *g2 : graphs_) {
+            const QVector<int> &v1 = table.getLabels(g1, GraphElement::VERTEX), &v2 = table.getLabels(g2, GraphElement::VERTEX);
+            for(int i=0; i < g1->getVertexCount(); ++i)
+                for(int k=0; k < g2->getVertexCount(); ++k)
+                    QCOMPARE(table.getSubstitutionCost(GraphElement::VERTEX, v1[i], v2[k]), weights_->substitutionCost(g1->getVertex(i), g2->getVertex(k)));
+            const QVector<int> &e1 = table.getLabels(g1, GraphElement::EDGE), &e2 = table.getLabels(g2, GraphElement::EDGE);
+            for(int ij=0; ij < g1->getEdgeCount(); ++ij)
+                for(int kl=0; kl < g2->getEdgeCount(); ++kl)
+                    QCOMPARE(table.getSubstitutionCost(GraphElement::EDGE, e1[ij], e2[kl]), weights_->substitutionCost(g1->getEdge(ij), g2->getEdge(kl)));
+        }
+    }
+}
+
+void TestLabelTable::hierarchical() {
+    // The graphs whose vertices hold graphs are left to the pairwise computation
+    QScopedPointer<Graph> subgraph(randomGraph(3, 2)), graph(randomGraph(4, 3));
+    graph->getVertex(1)->setGraph(subgraph.data());
+    LabelTable table(weights_);
+    table.addGraph(graph.data());
+    QVERIFY(!table.contains(graph.data()));
+    QCOMPARE(table.getLabelCount(GraphElement::VERTEX), 0);
+    graph->getVertex(1)->setGraph(0);
+}
+
+void TestLabelTable::invalid() {
+    LabelTable table(weights_);
+    table.addGraph(graphs_[0]);
+    QVERIFY_EXCEPTION_THROWN(table.getLabels(graphs_[1], GraphElement::VERTEX), std::exception);
+    table.computeCosts();
+    QVERIFY_EXCEPTION_THROWN(table.addGraph(graphs_[1]), std::exception);
+}
+
+QTEST_APPLESS_MAIN(TestLabelTable)
+
+#include "tst_labeltable.moc"
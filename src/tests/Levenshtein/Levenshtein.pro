@@ -0,0 +1,4 @@
+ROOT = ../..
+include($$ROOT/tests/test.pri)
+SOURCES += tst_levenshtein.cpp
+TARGET = tst_levenshtein
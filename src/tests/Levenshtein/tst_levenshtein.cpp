@@ -0,0 +1,90 @@
+#include <QtTest>
+#include "Core/StringPool.h"
+#include "Model/Weights.h"
+
+/**
+ * @brief Checks the bit-parallel Levenshtein distance against the dynamic programming one.
+ */
+class TestLevenshtein : public QObject {
+        Q_OBJECT
+
+    private slots:
+        void known_data();
+        void known();
+        void random();
+        void interned();
+};
+
+static uint reference(const QString &s1, const QString &s2) {
+    QVector<uint> previous(s2.size() + 1), current(s2.size() + 1);
+    for(int j=0; j <= s2.size(); ++j)
+        previous[j] = j;
+    for(int i=1; i <= s1.size(); ++i) {
+        current[0] = i;
+        for(int j=1; j <= s2.size(); ++j)
+            current[j] = qMin(qMin(previous[j] + 1, current[j-1] + 1), previous[j-1] + ((s1[i-1] == s2[j-1]) ? 0 : 1));
+        previous.swap(current);
+    }
+    return previous[s2.size()];
+}
+
+static QString randomString(int length, const QString &alphabet) {
+    QString s;
+    for(int i=0; i < length; ++i)
+        s.append(alphabet[qrand() % alphabet.size()]);
+    return s;
+}
+
+void TestLevenshtein::known_data() {
+    QTest::addColumn<QString>("s1");
+    QTest::addColumn<QString>("s2");
+    QTest::addColumn<uint>("distance");
+
+    QTest::newRow("empty") << QString("") << QString("") << 0u;
+    QTest::newRow("insertions") << QString("") << QString("abc") << 3u;
+    QTest::newRow("deletions") << QString("abc") << QString("") << 3u;
+    QTest::newRow("equal") << QString("carbon") << QString("carbon") << 0u;
+    QTest::newRow("kitten") << QString("kitten") << QString("sitting") << 3u;
+    QTest::newRow("flaw") << QString("flaw") << QString("lawn") << 2u;
+    QTest::newRow("prefix") << QString("benzene") << QString("benz") << 3u;
+    QTest::newRow("unicode") << QString::fromUtf8("αβγ") << QString::fromUtf8("αδγ") << 1u;
+    QTest::newRow("64") << QString(64, 'a') << QString(63, 'a') + "b" << 1u;
+    QTest::newRow("65") << QString(65, 'a') << QString(65, 'b') << 65u;
+    QTest::newRow("blocks") << QString(100, 'a') + "x" + QString(100, 'a') << QString(201, 'a') << 1u;
+}
+
+void TestLevenshtein::known() {
+    QFETCH(QString, s1);
+    QFETCH(QString, s2);
+    QFETCH(uint, distance);
+    QCOMPARE(levenshtein(s1, s2), distance);
+    QCOMPARE(levenshtein(s2, s1), distance);
+    QCOMPARE(reference(s1, s2), distance);
+}
+
+void TestLevenshtein::random() {
+    // The long strings span several blocks of 64 characters, the non Latin-1 ones use the slow masks
+    QStringList alphabets;
+    alphabets << "ab" << "acgt" << "abcdefghijklmnopqrstuvwxyz" << QString::fromUtf8("aéα中");
+    qsrand(42);
+    QString s1, s2;
+    for(const QString &alphabet : alphabets) {
+        for(int n=0; n < 2000; ++n) {
+            s1 = randomString(qrand() % ((n % 10) ? 20 : 200), alphabet);
+            s2 = randomString(qrand() % ((n % 10) ? 20 : 200), alphabet);
+            QCOMPARE(levenshtein(s1, s2), reference(s1, s2));
+        }
+    }
+}
+
+void TestLevenshtein::interned() {
+    QStringList strings;
+    strings << "C" << "Cl" << "O" << "N" << "carbon" << "chlorine" << QString(70, 'c') + "l";
+    for(const QString &s1 : strings)
+        for(const QString &s2 : strings)
+            QCOMPARE(levenshtein(StringPool::intern(s1), StringPool::intern(s2)), reference(s1, s2));
+}
+
+QTEST_APPLESS_MAIN(TestLevenshtein)
+
+#include "tst_levenshtein.moc"
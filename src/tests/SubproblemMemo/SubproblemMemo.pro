@@ -0,0 +1,4 @@
+ROOT = ../..
+include($$ROOT/tests/test.pri)
+SOURCES += tst_subproblemmemo.cpp
+TARGET = tst_subproblemmemo
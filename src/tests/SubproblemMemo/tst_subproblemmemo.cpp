@@ -0,0 +1,161 @@
+#include <QtTest>
+#include "Core/CancellationToken.h"
+#include "Model/SubproblemMemo.h"
+
+/**
+ * @brief Checks the keys of the ::SubproblemMemo and the hand-off of the subproblems between the
+ * problems which request them.
+ */
+class TestSubproblemMemo : public QObject {
+        Q_OBJECT
+
+    private slots:
+        void init();
+        void cleanup();
+        void keys();
+        void collision();
+        void handOff();
+
+    private:
+        Weights *weights_;
+        QList<Graph *> graphs_;
+};
+
+/**
+ * @brief Builds a ring of carbons with one oxygen, whose vertices and edges are listed from a shifted position.
+ */
+static Graph *ring(int n, int shift) {
+    Graph *graph = new Graph(Graph::UNDIRECTED);
+    Vertex *v;
+    for(int i=0; i < n; ++i) {
+        v = new Vertex();
+        v->addAttribute("chem", QMetaType::QString, ((i + shift) % n) ? "C" : "O");
+        graph->addVertex(v);
+    }
+    Edge *e;
+    for(int c=0; c < n; ++c) {
+        e = new Edge();
+        e->setOrigin(graph->getVertex((c + shift) % n));
+        e->setTarget(graph->getVertex((c + shift + 1) % n));
+        graph->addEdge(e);
+        e->getOrigin()->addEdge(e, Vertex::EDGE_OUT);
+        e->getTarget()->addEdge(e, Vertex::EDGE_IN);
+    }
+    return graph;
+}
+
+static Graph *fromEdges(int n, const QList<QPair<int, int> > &edges) {
+    Graph *graph = new Graph(Graph::UNDIRECTED);
+    for(int i=0; i < n; ++i)
+        graph->addVertex(new Vertex());
+    Edge *e;
+    for(const QPair<int, int> &edge : edges) {
+        e = new Edge();
+        e->setOrigin(graph->getVertex(edge.first));
+        e->setTarget(graph->getVertex(edge.second));
+        graph->addEdge(e);
+        e->getOrigin()->addEdge(e, Vertex::EDGE_OUT);
+        e->getTarget()->addEdge(e, Vertex::EDGE_IN);
+    }
+    return graph;
+}
+
+/**
+ * @brief Builds a graph whose single vertex holds a subgraph.
+ */
+static Graph *hierarchical(Graph *subgraph) {
+    Graph *graph = new Graph(Graph::UNDIRECTED);
+    Vertex *v = new Vertex();
+    v->setGraph(subgraph);
+    graph->addVertex(v);
+    return graph;
+}
+
+void TestSubproblemMemo::init() {
+    weights_ = new Weights();
+}
+
+void TestSubproblemMemo::cleanup() {
+    qDeleteAll(graphs_);
+    graphs_.clear();
+    delete weights_;
+}
+
+void TestSubproblemMemo::keys() {
+    // The same rings, listed from different positions, share their key unlike their plain hashes
+    graphs_ << ring(6, 0) << ring(5, 0) << ring(6, 2) << ring(5, 3) << ring(7, 0);
+    SubproblemMemo memo(weights_);
+    QVERIFY(graphs_[0]->getHash() != graphs_[2]->getHash());
+    QCOMPARE(memo.getKey(graphs_[2], graphs_[3]), memo.getKey(graphs_[0], graphs_[1]));
+    QCOMPARE(memo.getKey(graphs_[0], graphs_[1]), memo.getKey(graphs_[0], graphs_[1]));
+    QVERIFY(memo.getKey(graphs_[1], graphs_[0]) != memo.getKey(graphs_[0], graphs_[1]));
+    QVERIFY(memo.getKey(graphs_[0], graphs_[4]) != memo.getKey(graphs_[0], graphs_[1]));
+}
+
+void TestSubproblemMemo::collision() {
+    // K3,3 and the triangular prism share their canonical hash, but not their key
+    QList<QPair<int, int> > bipartite, prism;
+    for(int i=0; i < 3; ++i)
+        for(int k=3; k < 6; ++k)
+            bipartite.append(qMakePair(i, k));
+    prism << qMakePair(0, 1) << qMakePair(1, 2) << qMakePair(2, 0)
+          << qMakePair(3, 4) << qMakePair(4, 5) << qMakePair(5, 3)
+          << qMakePair(0, 3) << qMakePair(1, 4) << qMakePair(2, 5);
+    graphs_ << fromEdges(6, bipartite) << fromEdges(6, prism) << ring(4, 0);
+    QCOMPARE(graphs_[0]->getCanonicalHash(), graphs_[1]->getCanonicalHash());
+    SubproblemMemo memo(weights_);
+    QByteArray key = memo.getKey(graphs_[0], graphs_[2]);
+    QVERIFY(memo.getKey(graphs_[1], graphs_[2]) != key);
+    QCOMPARE(memo.getKey(graphs_[0], graphs_[2]), key);
+}
+
+void TestSubproblemMemo::handOff() {
+    // Four problems need the distance between the same two rings
+    graphs_ << ring(6, 0) << ring(5, 0) << ring(6, 1) << ring(5, 2);
+    graphs_ << hierarchical(graphs_[0]) << hierarchical(graphs_[1]) << hierarchical(graphs_[2]) << hierarchical(graphs_[3]);
+    SubproblemMemo memo(weights_);
+    CancellationToken tokens[4];
+    QList<Problem *> problems;
+    QHash<Problem *, Problem *> prepared;
+    QHash<Problem *, int> ready;
+    for(int p=0; p < 4; ++p) {
+        problems.append(new Problem(Problem::GED, graphs_[4 + 2*(p % 2)], graphs_[5 + 2*(p % 2)]));
+        problems[p]->setSubproblemMemo(&memo);
+        problems[p]->setCancellationToken(&tokens[p]);
+        Problem *problem = problems[p];
+        connect(problem, &Problem::prepare, [problem, &prepared](Problem *subproblem, Weights *) { prepared.insert(problem, subproblem); });
+        connect(problem, &Problem::ready, [&ready](Problem *problem) { ++ready[problem]; });
+    }
+
+    // The first problem solves the pair, the next two wait for it
+    for(int p=0; p < 3; ++p)
+        problems[p]->computeCosts(weights_);
+    QCOMPARE(prepared.size(), 1);
+    QVERIFY(prepared.contains(problems[0]));
+    QCOMPARE(ready.size(), 0);
+
+    // The first two problems are cancelled: the value is only right for the second, the third solves the pair again
+    tokens[0].cancel();
+    tokens[1].cancel();
+    QVERIFY(QMetaObject::invokeMethod(problems[0], "updateCost", Qt::DirectConnection, Q_ARG(Problem *, prepared.value(problems[0])), Q_ARG(double, 5.0)));
+    QCOMPARE(ready.value(problems[0]), 1);
+    QCOMPARE(ready.value(problems[1]), 1);
+    QCOMPARE(ready.value(problems[2]), 0);
+    QVERIFY(prepared.contains(problems[2]));
+    QCOMPARE(memo.getCount(), 0);
+
+    // Its value is kept, and given at once to the next request
+    QVERIFY(QMetaObject::invokeMethod(problems[2], "updateCost", Qt::DirectConnection, Q_ARG(Problem *, prepared.value(problems[2])), Q_ARG(double, 7.0)));
+    QCOMPARE(ready.value(problems[2]), 1);
+    QCOMPARE(memo.getCount(), 1);
+    problems[3]->computeCosts(weights_);
+    QVERIFY(!prepared.contains(problems[3]));
+    QCOMPARE(ready.value(problems[3]), 1);
+    QCOMPARE(problems[3]->getCost(GraphElement::VERTEX, 0, 0), problems[2]->getCost(GraphElement::VERTEX, 0, 0));
+
+    qDeleteAll(problems);
+}
+
+QTEST_GUILESS_MAIN(TestSubproblemMemo)
+
+#include "tst_subproblemmemo.moc"
@@ -0,0 +1,54 @@
+Creator "GEM++"
+graph [
+  directed 0
+  node [
+    id 0
+    label "C1"
+    charge 0
+    chem "C"
+    x 1.5
+  ]
+  node [
+    id 1
+    label "O1"
+    charge -1
+    chem "O"
+    comment "carbonyl"
+    x 2.25
+  ]
+  node [
+    id 2
+    label "C2"
+    charge 0
+    chem "C"
+    x -0.5
+  ]
+  node [
+    id 3
+    label "N1"
+    charge 1
+    chem "N"
+    x 0.0
+  ]
+  edge [
+    source 0
+    target 1
+    valence 2
+  ]
+  edge [
+    source 0
+    target 2
+    label "single"
+    valence 1
+  ]
+  edge [
+    source 2
+    target 3
+    valence 1
+  ]
+  edge [
+    source 3
+    target 0
+    valence 3
+  ]
+]
@@ -0,0 +1,14 @@
+include(../common.pri)
+QT += core xml testlib
+CONFIG += console testcase
+CONFIG -= app_bundle
+linux {
+    QMAKE_CXXFLAGS += -std=c++11
+    QMAKE_LFLAGS += -Wl,-rpath,\'$$absolute_path($$OUTLIB, $$OUT_PWD)\'
+    QMAKE_LFLAGS += -Wl,--rpath-link=$$[QT_INSTALL_LIBS]:$$OUTLIB
+    QMAKE_RPATH =
+}
+LIBS += -L$$OUTLIB -lGEM++$$LIBMODE
+INCLUDEPATH += $$ROOT/library/ $$PWD
+# The small graphs shared by the tests
+DEFINES += GEMPP_FIXTURES=\\\"$$PWD/fixtures\\\"
@@ -0,0 +1,2 @@
+TEMPLATE = subdirs
+SUBDIRS = CostProgram LabelTable Levenshtein CostMatrices GraphBuilder GMLReader GXLReader CanonicalHash GraphList SubproblemMemo